@@ -0,0 +1,149 @@
+/**
+ * @file check_interp.c
+ * @brief Check the interpolator kernel contracts at their edge sizes
+ *
+ * Compares every kernel in src/ili9225_interp.c with a naive definition of
+ * its contract: palette expansion at 1/2/4/8 bpp from odd start pixels, row
+ * scaling, and texture sampling on 1-pixel-wide, 1-pixel-tall and
+ * 2^16-pixel textures with negative steps and wrapping coordinates.
+ *
+ * The public kernels and their portable _c versions are both checked. On a
+ * host build (ILI9225_USE_INTERP=0) they are the same code; built for the
+ * RP2040 the public ones run on the SIO interpolators, so this also
+ * compares the two paths bit for bit.
+ *
+ * Build & run (host, with the Pico SDK headers on the include path):
+ *   gcc -O2 -ffunction-sections -Wl,--gc-sections -DILI9225_USE_INTERP=0 \
+ *       -I../src -I../src/fonts -I../src/utilities \
+ *       check_interp.c ../src/ili9225_interp.c -o check_interp
+ *   ./check_interp
+ *
+ * --gc-sections drops ili9225_draw_rgb565_scaled, so the rest of the driver
+ * need not be linked.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../src/ili9225_interp.h"
+
+#define TEXTURE_PIXELS (1u << 16)
+#define MAX_SPAN 300
+
+// ============================================================================
+// Naive Reference Kernels
+// ============================================================================
+
+static void naive_expand(uint16_t* out, const uint8_t* line, uint32_t x, uint32_t count,
+                         uint8_t bpp, const uint16_t* palette) {
+    // Pixels are packed MSB first
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t bit = (x + i) * bpp;
+        uint32_t index = 0;
+        for (uint8_t b = 0; b < bpp; b++, bit++) {
+            index = (index << 1) | ((line[bit / 8] >> (7 - bit % 8)) & 1);
+        }
+        out[i] = palette[index];
+    }
+}
+
+static void naive_scale(uint16_t* out, uint32_t count, const uint16_t* src, uint32_t u, uint32_t du) {
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = src[(uint32_t)(u + i * du) / 65536];
+    }
+}
+
+static void naive_texture(uint16_t* out, uint32_t count, const uint16_t* texture,
+                          uint8_t log2_w, uint8_t log2_h, uint32_t u, uint32_t v, int32_t du, int32_t dv) {
+    uint32_t w = 1u << log2_w, h = 1u << log2_h;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t col = ((uint32_t)(u + i * (uint32_t)du) / 65536) % w;
+        uint32_t row = ((uint32_t)(v + i * (uint32_t)dv) / 65536) % h;
+        out[i] = texture[row * w + col];
+    }
+}
+
+// ============================================================================
+// Harness
+// ============================================================================
+
+static uint16_t texture[TEXTURE_PIXELS];
+static uint16_t palette[256];
+static uint8_t line[MAX_SPAN * 2];
+static uint16_t ref[MAX_SPAN], out[MAX_SPAN], out_c[MAX_SPAN];
+static int failures = 0;
+
+static uint32_t rand32(void) {
+    return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+static void check(const char* name, uint32_t n, unsigned a, unsigned b) {
+    if (memcmp(ref, out_c, n * sizeof(uint16_t)) != 0) {
+        printf("  MISMATCH in %s_c (n=%u, %u, %u)\n", name, (unsigned)n, a, b);
+        failures++;
+    }
+    if (memcmp(ref, out, n * sizeof(uint16_t)) != 0) {
+        printf("  MISMATCH in %s (n=%u, %u, %u)\n", name, (unsigned)n, a, b);
+        failures++;
+    }
+}
+
+static void verify_expand(void) {
+    static const uint8_t bpps[] = { 1, 2, 4, 8 };
+    for (int round = 0; round < 400; round++) {
+        uint8_t bpp = bpps[round & 3];
+        uint32_t x = (uint32_t)rand() % 64;
+        uint32_t n = (uint32_t)rand() % (MAX_SPAN - 64);
+        naive_expand(ref, line, x, n, bpp, palette);
+        ili9225_expand_indices(out, line, x, n, bpp, palette);
+        ili9225_expand_indices_c(out_c, line, x, n, bpp, palette);
+        check("expand_indices", n, bpp, x);
+    }
+}
+
+static void verify_scale(void) {
+    for (int round = 0; round < 400; round++) {
+        uint32_t n = (uint32_t)rand() % MAX_SPAN;
+        uint32_t u = rand32() % (1u << 24);
+        uint32_t du = rand32() % (4u << 16);
+        if (n > 0 && (u + (uint64_t)du * (n - 1)) / 65536 >= TEXTURE_PIXELS) continue;
+        naive_scale(ref, n, texture, u, du);
+        ili9225_scale_row(out, n, texture, u, du);
+        ili9225_scale_row_c(out_c, n, texture, u, du);
+        check("scale_row", n, (unsigned)u, (unsigned)du);
+    }
+}
+
+static void verify_texture(void) {
+    // Every size from 1x1 to the largest the lanes allow
+    for (uint8_t log2_w = 0; log2_w <= 15; log2_w++) {
+        for (uint8_t log2_h = 0; log2_w + log2_h <= 16; log2_h++) {
+            for (int round = 0; round < 8; round++) {
+                uint32_t n = (uint32_t)rand() % MAX_SPAN;
+                uint32_t u = rand32(), v = rand32();
+                int32_t du = (int32_t)(rand32() % (8u << 16)) - (4 << 16);
+                int32_t dv = (int32_t)(rand32() % (8u << 16)) - (4 << 16);
+                naive_texture(ref, n, texture, log2_w, log2_h, u, v, du, dv);
+                ili9225_texture_span(out, n, texture, log2_w, log2_h, u, v, du, dv);
+                ili9225_texture_span_c(out_c, n, texture, log2_w, log2_h, u, v, du, dv);
+                check("texture_span", n, log2_w, log2_h);
+            }
+        }
+    }
+}
+
+int main(void) {
+    srand(12345);
+    for (uint32_t i = 0; i < TEXTURE_PIXELS; i++) texture[i] = (uint16_t)rand();
+    for (uint32_t i = 0; i < 256; i++) palette[i] = (uint16_t)rand();
+    for (uint32_t i = 0; i < sizeof(line); i++) line[i] = (uint8_t)rand();
+
+    printf("Checking interpolator kernels against naive code...\n");
+    verify_expand();
+    verify_scale();
+    verify_texture();
+    printf("  %s\n", failures ? "FAILED" : "all kernels bit-exact");
+    return failures ? 1 : 0;
+}
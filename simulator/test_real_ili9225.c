@@ -219,10 +219,11 @@ void test_temperature_text(ili9225_config_t* lcd) {
     // Simulate temperature readings
     for (int temp = -10; temp <= 40; temp += 10) {
         char temp_str[16];
-        snprintf(temp_str, sizeof(temp_str), "Temp: %d C", temp);
+        // Trailing spaces cover a wider previous reading
+        snprintf(temp_str, sizeof(temp_str), "Temp: %3d C  ", temp);
         
-        ili9225_fill_rect(lcd, 0, 80, lcd->width, 20, COLOR_BLACK); // Clear area
-        ili9225_draw_text(lcd, 10, 80, temp_str, &font_5x8, COLOR_YELLOW);
+        // Opaque text replaces the old reading, no separate clear needed
+        ili9225_draw_gfx_text_opaque(lcd, 10, 95, temp_str, &FreeSansBold9pt7b, COLOR_YELLOW, COLOR_BLACK);
         sim_mock_flush_framebuffer();
         sleep(1);
     }
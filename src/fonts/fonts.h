@@ -12,111 +12,132 @@
 
 #include "pico/stdlib.h"
 
+// Fixed-width bitmap font. Each character is `height` bytes, one per row from
+// the top; bit n of a row byte is column n from the left (width <= 8).
 typedef struct {
     const uint8_t *data;
     uint8_t width;
     uint8_t height;
     uint8_t first_char;
     uint8_t last_char;
+    uint8_t spacing;        // Blank columns between characters
 } font_t;
 
 // 5x8 Font (Basic ASCII)
+//
+// The glyphs are listed column by column (5 bytes per character, bit 0 = top
+// row) and transposed by the preprocessor into the row-major layout font_t
+// uses, so the table stays readable and costs nothing at run time.
+#define FONT_5X8_GLYPHS(G) \
+    G(0x00, 0x00, 0x00, 0x00, 0x00) /* (space) */   \
+    G(0x00, 0x00, 0x5F, 0x00, 0x00) /* ! */         \
+    G(0x00, 0x07, 0x00, 0x07, 0x00) /* " */         \
+    G(0x14, 0x7F, 0x14, 0x7F, 0x14) /* # */         \
+    G(0x24, 0x2A, 0x7F, 0x2A, 0x12) /* $ */         \
+    G(0x23, 0x13, 0x08, 0x64, 0x62) /* % */         \
+    G(0x36, 0x49, 0x55, 0x22, 0x50) /* & */         \
+    G(0x00, 0x05, 0x03, 0x00, 0x00) /* ' */         \
+    G(0x00, 0x1C, 0x22, 0x41, 0x00) /* ( */         \
+    G(0x00, 0x41, 0x22, 0x1C, 0x00) /* ) */         \
+    G(0x08, 0x2A, 0x1C, 0x2A, 0x08) /* * */         \
+    G(0x08, 0x08, 0x3E, 0x08, 0x08) /* + */         \
+    G(0x00, 0x50, 0x30, 0x00, 0x00) /* , */         \
+    G(0x08, 0x08, 0x08, 0x08, 0x08) /* - */         \
+    G(0x00, 0x60, 0x60, 0x00, 0x00) /* . */         \
+    G(0x20, 0x10, 0x08, 0x04, 0x02) /* / */         \
+    G(0x3E, 0x51, 0x49, 0x45, 0x3E) /* 0 */         \
+    G(0x00, 0x42, 0x7F, 0x40, 0x00) /* 1 */         \
+    G(0x42, 0x61, 0x51, 0x49, 0x46) /* 2 */         \
+    G(0x21, 0x41, 0x45, 0x4B, 0x31) /* 3 */         \
+    G(0x18, 0x14, 0x12, 0x7F, 0x10) /* 4 */         \
+    G(0x27, 0x45, 0x45, 0x45, 0x39) /* 5 */         \
+    G(0x3C, 0x4A, 0x49, 0x49, 0x30) /* 6 */         \
+    G(0x01, 0x71, 0x09, 0x05, 0x03) /* 7 */         \
+    G(0x36, 0x49, 0x49, 0x49, 0x36) /* 8 */         \
+    G(0x06, 0x49, 0x49, 0x29, 0x1E) /* 9 */         \
+    G(0x00, 0x36, 0x36, 0x00, 0x00) /* : */         \
+    G(0x00, 0x56, 0x36, 0x00, 0x00) /* ; */         \
+    G(0x00, 0x08, 0x14, 0x22, 0x41) /* < */         \
+    G(0x14, 0x14, 0x14, 0x14, 0x14) /* = */         \
+    G(0x41, 0x22, 0x14, 0x08, 0x00) /* > */         \
+    G(0x02, 0x01, 0x51, 0x09, 0x06) /* ? */         \
+    G(0x32, 0x49, 0x79, 0x41, 0x3E) /* @ */         \
+    G(0x7E, 0x11, 0x11, 0x11, 0x7E) /* A */         \
+    G(0x7F, 0x49, 0x49, 0x49, 0x36) /* B */         \
+    G(0x3E, 0x41, 0x41, 0x41, 0x22) /* C */         \
+    G(0x7F, 0x41, 0x41, 0x22, 0x1C) /* D */         \
+    G(0x7F, 0x49, 0x49, 0x49, 0x41) /* E */         \
+    G(0x7F, 0x09, 0x09, 0x01, 0x01) /* F */         \
+    G(0x3E, 0x41, 0x41, 0x51, 0x32) /* G */         \
+    G(0x7F, 0x08, 0x08, 0x08, 0x7F) /* H */         \
+    G(0x00, 0x41, 0x7F, 0x41, 0x00) /* I */         \
+    G(0x20, 0x40, 0x41, 0x3F, 0x01) /* J */         \
+    G(0x7F, 0x08, 0x14, 0x22, 0x41) /* K */         \
+    G(0x7F, 0x40, 0x40, 0x40, 0x40) /* L */         \
+    G(0x7F, 0x02, 0x04, 0x02, 0x7F) /* M */         \
+    G(0x7F, 0x04, 0x08, 0x10, 0x7F) /* N */         \
+    G(0x3E, 0x41, 0x41, 0x41, 0x3E) /* O */         \
+    G(0x7F, 0x09, 0x09, 0x09, 0x06) /* P */         \
+    G(0x3E, 0x41, 0x51, 0x21, 0x5E) /* Q */         \
+    G(0x7F, 0x09, 0x19, 0x29, 0x46) /* R */         \
+    G(0x46, 0x49, 0x49, 0x49, 0x31) /* S */         \
+    G(0x01, 0x01, 0x7F, 0x01, 0x01) /* T */         \
+    G(0x3F, 0x40, 0x40, 0x40, 0x3F) /* U */         \
+    G(0x1F, 0x20, 0x40, 0x20, 0x1F) /* V */         \
+    G(0x7F, 0x20, 0x18, 0x20, 0x7F) /* W */         \
+    G(0x63, 0x14, 0x08, 0x14, 0x63) /* X */         \
+    G(0x03, 0x04, 0x78, 0x04, 0x03) /* Y */         \
+    G(0x61, 0x51, 0x49, 0x45, 0x43) /* Z */         \
+    G(0x00, 0x00, 0x7F, 0x41, 0x41) /* [ */         \
+    G(0x02, 0x04, 0x08, 0x10, 0x20) /* backslash */ \
+    G(0x41, 0x41, 0x7F, 0x00, 0x00) /* ] */         \
+    G(0x04, 0x02, 0x01, 0x02, 0x04) /* ^ */         \
+    G(0x40, 0x40, 0x40, 0x40, 0x40) /* _ */         \
+    G(0x00, 0x01, 0x02, 0x04, 0x00) /* ` */         \
+    G(0x20, 0x54, 0x54, 0x54, 0x78) /* a */         \
+    G(0x7F, 0x48, 0x44, 0x44, 0x38) /* b */         \
+    G(0x38, 0x44, 0x44, 0x44, 0x20) /* c */         \
+    G(0x38, 0x44, 0x44, 0x48, 0x7F) /* d */         \
+    G(0x38, 0x54, 0x54, 0x54, 0x18) /* e */         \
+    G(0x08, 0x7E, 0x09, 0x01, 0x02) /* f */         \
+    G(0x08, 0x14, 0x54, 0x54, 0x3C) /* g */         \
+    G(0x7F, 0x08, 0x04, 0x04, 0x78) /* h */         \
+    G(0x00, 0x44, 0x7D, 0x40, 0x00) /* i */         \
+    G(0x20, 0x40, 0x44, 0x3D, 0x00) /* j */         \
+    G(0x7F, 0x10, 0x28, 0x44, 0x00) /* k */         \
+    G(0x00, 0x41, 0x7F, 0x40, 0x00) /* l */         \
+    G(0x7C, 0x04, 0x18, 0x04, 0x78) /* m */         \
+    G(0x7C, 0x08, 0x04, 0x04, 0x78) /* n */         \
+    G(0x38, 0x44, 0x44, 0x44, 0x38) /* o */         \
+    G(0x7C, 0x14, 0x14, 0x14, 0x08) /* p */         \
+    G(0x08, 0x14, 0x14, 0x18, 0x7C) /* q */         \
+    G(0x7C, 0x08, 0x04, 0x04, 0x08) /* r */         \
+    G(0x48, 0x54, 0x54, 0x54, 0x20) /* s */         \
+    G(0x04, 0x3F, 0x44, 0x40, 0x20) /* t */         \
+    G(0x3C, 0x40, 0x40, 0x20, 0x7C) /* u */         \
+    G(0x1C, 0x20, 0x40, 0x20, 0x1C) /* v */         \
+    G(0x3C, 0x40, 0x30, 0x40, 0x3C) /* w */         \
+    G(0x44, 0x28, 0x10, 0x28, 0x44) /* x */         \
+    G(0x0C, 0x50, 0x50, 0x50, 0x3C) /* y */         \
+    G(0x44, 0x64, 0x54, 0x4C, 0x44) /* z */         \
+    G(0x00, 0x08, 0x36, 0x41, 0x00) /* { */         \
+    G(0x00, 0x00, 0x7F, 0x00, 0x00) /* | */         \
+    G(0x00, 0x41, 0x36, 0x08, 0x00) /* } */         \
+    G(0x08, 0x04, 0x08, 0x10, 0x08) /* ~ */
+
+// Row r of a glyph given as columns c0..c4: bit n is column n
+#define FONT_5X8_ROW(r, c0, c1, c2, c3, c4) \
+    (uint8_t)((((c0) >> (r)) & 1) | ((((c1) >> (r)) & 1) << 1) | ((((c2) >> (r)) & 1) << 2) | \
+              ((((c3) >> (r)) & 1) << 3) | ((((c4) >> (r)) & 1) << 4))
+
+#define FONT_5X8_ROWS(c0, c1, c2, c3, c4) \
+    FONT_5X8_ROW(0, c0, c1, c2, c3, c4), FONT_5X8_ROW(1, c0, c1, c2, c3, c4), \
+    FONT_5X8_ROW(2, c0, c1, c2, c3, c4), FONT_5X8_ROW(3, c0, c1, c2, c3, c4), \
+    FONT_5X8_ROW(4, c0, c1, c2, c3, c4), FONT_5X8_ROW(5, c0, c1, c2, c3, c4), \
+    FONT_5X8_ROW(6, c0, c1, c2, c3, c4), FONT_5X8_ROW(7, c0, c1, c2, c3, c4),
+
 static const uint8_t font_5x8_data[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, // (space)
-    0x00, 0x00, 0x5F, 0x00, 0x00, // !
-    0x00, 0x07, 0x00, 0x07, 0x00, // "
-    0x14, 0x7F, 0x14, 0x7F, 0x14, // #
-    0x24, 0x2A, 0x7F, 0x2A, 0x12, // $
-    0x23, 0x13, 0x08, 0x64, 0x62, // %
-    0x36, 0x49, 0x55, 0x22, 0x50, // &
-    0x00, 0x05, 0x03, 0x00, 0x00, // '
-    0x00, 0x1C, 0x22, 0x41, 0x00, // (
-    0x00, 0x41, 0x22, 0x1C, 0x00, // )
-    0x08, 0x2A, 0x1C, 0x2A, 0x08, // *
-    0x08, 0x08, 0x3E, 0x08, 0x08, // +
-    0x00, 0x50, 0x30, 0x00, 0x00, // ,
-    0x08, 0x08, 0x08, 0x08, 0x08, // -
-    0x00, 0x60, 0x60, 0x00, 0x00, // .
-    0x20, 0x10, 0x08, 0x04, 0x02, // /
-    0x3E, 0x51, 0x49, 0x45, 0x3E, // 0
-    0x00, 0x42, 0x7F, 0x40, 0x00, // 1
-    0x42, 0x61, 0x51, 0x49, 0x46, // 2
-    0x21, 0x41, 0x45, 0x4B, 0x31, // 3
-    0x18, 0x14, 0x12, 0x7F, 0x10, // 4
-    0x27, 0x45, 0x45, 0x45, 0x39, // 5
-    0x3C, 0x4A, 0x49, 0x49, 0x30, // 6
-    0x01, 0x71, 0x09, 0x05, 0x03, // 7
-    0x36, 0x49, 0x49, 0x49, 0x36, // 8
-    0x06, 0x49, 0x49, 0x29, 0x1E, // 9
-    0x00, 0x36, 0x36, 0x00, 0x00, // :
-    0x00, 0x56, 0x36, 0x00, 0x00, // ;
-    0x00, 0x08, 0x14, 0x22, 0x41, // <
-    0x14, 0x14, 0x14, 0x14, 0x14, // =
-    0x41, 0x22, 0x14, 0x08, 0x00, // >
-    0x02, 0x01, 0x51, 0x09, 0x06, // ?
-    0x32, 0x49, 0x79, 0x41, 0x3E, // @
-    0x7E, 0x11, 0x11, 0x11, 0x7E, // A
-    0x7F, 0x49, 0x49, 0x49, 0x36, // B
-    0x3E, 0x41, 0x41, 0x41, 0x22, // C
-    0x7F, 0x41, 0x41, 0x22, 0x1C, // D
-    0x7F, 0x49, 0x49, 0x49, 0x41, // E
-    0x7F, 0x09, 0x09, 0x01, 0x01, // F
-    0x3E, 0x41, 0x41, 0x51, 0x32, // G
-    0x7F, 0x08, 0x08, 0x08, 0x7F, // H
-    0x00, 0x41, 0x7F, 0x41, 0x00, // I
-    0x20, 0x40, 0x41, 0x3F, 0x01, // J
-    0x7F, 0x08, 0x14, 0x22, 0x41, // K
-    0x7F, 0x40, 0x40, 0x40, 0x40, // L
-    0x7F, 0x02, 0x04, 0x02, 0x7F, // M
-    0x7F, 0x04, 0x08, 0x10, 0x7F, // N
-    0x3E, 0x41, 0x41, 0x41, 0x3E, // O
-    0x7F, 0x09, 0x09, 0x09, 0x06, // P
-    0x3E, 0x41, 0x51, 0x21, 0x5E, // Q
-    0x7F, 0x09, 0x19, 0x29, 0x46, // R
-    0x46, 0x49, 0x49, 0x49, 0x31, // S
-    0x01, 0x01, 0x7F, 0x01, 0x01, // T
-    0x3F, 0x40, 0x40, 0x40, 0x3F, // U
-    0x1F, 0x20, 0x40, 0x20, 0x1F, // V
-    0x7F, 0x20, 0x18, 0x20, 0x7F, // W
-    0x63, 0x14, 0x08, 0x14, 0x63, // X
-    0x03, 0x04, 0x78, 0x04, 0x03, // Y
-    0x61, 0x51, 0x49, 0x45, 0x43, // Z
-    0x00, 0x00, 0x7F, 0x41, 0x41, // [
-    0x02, 0x04, 0x08, 0x10, 0x20, // backslash
-    0x41, 0x41, 0x7F, 0x00, 0x00, // ]
-    0x04, 0x02, 0x01, 0x02, 0x04, // ^
-    0x40, 0x40, 0x40, 0x40, 0x40, // _
-    0x00, 0x01, 0x02, 0x04, 0x00, // `
-    0x20, 0x54, 0x54, 0x54, 0x78, // a
-    0x7F, 0x48, 0x44, 0x44, 0x38, // b
-    0x38, 0x44, 0x44, 0x44, 0x20, // c
-    0x38, 0x44, 0x44, 0x48, 0x7F, // d
-    0x38, 0x54, 0x54, 0x54, 0x18, // e
-    0x08, 0x7E, 0x09, 0x01, 0x02, // f
-    0x08, 0x14, 0x54, 0x54, 0x3C, // g
-    0x7F, 0x08, 0x04, 0x04, 0x78, // h
-    0x00, 0x44, 0x7D, 0x40, 0x00, // i
-    0x20, 0x40, 0x44, 0x3D, 0x00, // j
-    0x7F, 0x10, 0x28, 0x44, 0x00, // k
-    0x00, 0x41, 0x7F, 0x40, 0x00, // l
-    0x7C, 0x04, 0x18, 0x04, 0x78, // m
-    0x7C, 0x08, 0x04, 0x04, 0x78, // n
-    0x38, 0x44, 0x44, 0x44, 0x38, // o
-    0x7C, 0x14, 0x14, 0x14, 0x08, // p
-    0x08, 0x14, 0x14, 0x18, 0x7C, // q
-    0x7C, 0x08, 0x04, 0x04, 0x08, // r
-    0x48, 0x54, 0x54, 0x54, 0x20, // s
-    0x04, 0x3F, 0x44, 0x40, 0x20, // t
-    0x3C, 0x40, 0x40, 0x20, 0x7C, // u
-    0x1C, 0x20, 0x40, 0x20, 0x1C, // v
-    0x3C, 0x40, 0x30, 0x40, 0x3C, // w
-    0x44, 0x28, 0x10, 0x28, 0x44, // x
-    0x0C, 0x50, 0x50, 0x50, 0x3C, // y
-    0x44, 0x64, 0x54, 0x4C, 0x44, // z
-    0x00, 0x08, 0x36, 0x41, 0x00, // {
-    0x00, 0x00, 0x7F, 0x00, 0x00, // |
-    0x00, 0x41, 0x36, 0x08, 0x00, // }
-    0x08, 0x04, 0x08, 0x10, 0x08, // ~
+    FONT_5X8_GLYPHS(FONT_5X8_ROWS)
 };
 
 // 8x8 Font (More readable)
@@ -224,7 +245,8 @@ static const font_t font_5x8 = {
     .width = 5,
     .height = 8,
     .first_char = 32,
-    .last_char = 126
+    .last_char = 126,
+    .spacing = 1
 };
 
 static const font_t font_8x8 = {
@@ -232,7 +254,8 @@ static const font_t font_8x8 = {
     .width = 8,
     .height = 8,
     .first_char = 32,
-    .last_char = 126
+    .last_char = 126,
+    .spacing = 0
 };
 
 #endif
\ No newline at end of file
@@ -16,9 +16,12 @@
  */
 
 #include "ili9225.h"
+#include "ili9225_internal.h"
+#include "ili9225_glyph_cache.h"
 #include <stdlib.h>
 #include <string.h> // For memset/memcpy if needed
 #include "hardware/gpio.h"
+#include "hardware/dma.h"
 #include "log.h" // Assuming you have a log.h similar to your previous snippet
 
 // Uncomment to enable detailed logging
@@ -36,41 +39,257 @@ static inline void lcd_deselect(ili9225_t* lcd) {
     gpio_put(lcd->pin_cs, 1);
 }
 
-static void ili9225_write_command(ili9225_t* lcd, uint8_t cmd) {
-    gpio_put(lcd->pin_dc, 0); // 0 = Command
+// Switch the PL022 frame size. Only valid while the SPI is idle.
+static inline void lcd_set_frame_bits(ili9225_t* lcd, uint8_t bits) {
+    if (lcd->spi_bits == bits) return;
+    spi_set_format(lcd->spi, bits, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    lcd->spi_bits = bits;
+}
+
+// Complete an in-flight DMA transfer and hand the bus back to the CPU
+static void lcd_dma_finish(ili9225_t* lcd) {
+    dma_channel_wait_for_finish_blocking(lcd->dma_chan);
+    // DMA completion only means the FIFO was fed; wait for the last frame to shift out
+    while (spi_is_busy(lcd->spi)) {
+        tight_loop_contents();
+    }
+    lcd_deselect(lcd);
+    lcd->dma_busy = false;
+}
+
+// Stream `count` RGB565 pixels into GRAM using 16-bit frames. The window must
+// already be set. With `incr` false the same pixel is repeated (solid fill).
+void ili9225_panel_stream(ili9225_t* lcd, const uint16_t* src, uint32_t count,
+                          bool incr, bool wait) {
+    gpio_put(lcd->pin_dc, 1); // Data
     lcd_select(lcd);
-    spi_write_blocking(lcd->spi, &cmd, 1);
+    // 16-bit frames take native uint16_t pixels, no hi/lo byte splitting
+    lcd_set_frame_bits(lcd, 16);
+
+    if (lcd->dma_chan >= 0 && count >= ILI9225_DMA_MIN_PIXELS) {
+        dma_channel_config c = dma_channel_get_default_config(lcd->dma_chan);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+        channel_config_set_read_increment(&c, incr);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, spi_get_dreq(lcd->spi, true));
+        dma_channel_configure(lcd->dma_chan, &c, &spi_get_hw(lcd->spi)->dr,
+                              src, count, true);
+        lcd->dma_busy = true;
+
+        if (wait) {
+            lcd_dma_finish(lcd);
+        }
+        return;
+    }
+
+    if (incr) {
+        spi_write16_blocking(lcd->spi, src, count);
+    } else {
+        // CPU fallback: send the colour in chunks rather than one frame per call
+        uint16_t buf[32];
+        for (size_t i = 0; i < count_of(buf); i++) {
+            buf[i] = *src;
+        }
+        while (count > 0) {
+            uint32_t n = count < count_of(buf) ? count : count_of(buf);
+            spi_write16_blocking(lcd->spi, buf, n);
+            count -= n;
+        }
+    }
+
     lcd_deselect(lcd);
 }
 
-static void ili9225_write_data16(ili9225_t* lcd, uint16_t data) {
+// Write pixels into the current window of whichever target is active
+// RAM targets never wait for the bus, so rendering overlaps any running transfer.
+static void lcd_write_gram(ili9225_t* lcd, const uint16_t* src, uint32_t count, bool incr, bool wait) {
+    if (lcd->framebuffer) {
+        ili9225_fb_write(lcd, src, count, incr);
+        return;
+    }
+    ili9225_wait_idle(lcd);
+    ili9225_panel_stream(lcd, src, count, incr, wait);
+}
+
+// Stream `count` copies of `color` into GRAM. The window must already be set.
+static void lcd_fill_pixels(ili9225_t* lcd, uint16_t color, uint32_t count, bool wait) {
+    if (lcd->framebuffer) {
+        ili9225_fb_write(lcd, &color, count, false);
+        return;
+    }
+    ili9225_wait_idle(lcd);
+    lcd->dma_color = color; // DMA reads the colour from here for the whole transfer
+    ili9225_panel_stream(lcd, &lcd->dma_color, count, false, wait);
+}
+
+// Send one index/data pair. CS must already be asserted with 8-bit frames.
+static inline void lcd_write_reg(ili9225_t* lcd, uint8_t reg, uint16_t value) {
+    gpio_put(lcd->pin_dc, 0); // 0 = Command
+    spi_write_blocking(lcd->spi, &reg, 1);
     gpio_put(lcd->pin_dc, 1); // 1 = Data
-    lcd_select(lcd);
-    uint8_t buf[2] = { (uint8_t)(data >> 8), (uint8_t)(data & 0xFF) };
+    uint8_t buf[2] = { (uint8_t)(value >> 8), (uint8_t)(value & 0xFF) };
     spi_write_blocking(lcd->spi, buf, 2);
+}
+
+static inline bool lcd_shadow_valid(const ili9225_t* lcd, uint8_t reg) {
+    return (lcd->reg_shadow_valid[reg >> 5] >> (reg & 31)) & 1u;
+}
+
+static inline void lcd_shadow_invalidate(ili9225_t* lcd, uint8_t reg) {
+    lcd->reg_shadow_valid[reg >> 5] &= ~(1u << (reg & 31));
+}
+
+// Returns true if the write can be skipped; otherwise records the new value
+static bool lcd_shadow_update(ili9225_t* lcd, uint8_t reg, uint16_t value) {
+    // GRAM data is not a register, and out-of-range indices are never cached
+    if (reg >= ILI9225_REG_SHADOW_SIZE || reg == ILI9225_GRAM_DATA_REG) {
+        return false;
+    }
+    if (lcd_shadow_valid(lcd, reg) && lcd->reg_shadow[reg] == value) {
+        return true;
+    }
+    lcd->reg_shadow[reg] = value;
+    lcd->reg_shadow_valid[reg >> 5] |= 1u << (reg & 31);
+    return false;
+}
+
+// Send a register batch, optionally finishing with the GRAM index so pixel
+// data can follow. Unchanged registers are skipped. CS must already be
+// asserted with 8-bit frames.
+static void lcd_send_regs(ili9225_t* lcd, const ili9225_reg_t* regs, size_t count, bool open_gram) {
+    for (size_t i = 0; i < count; i++) {
+        if (lcd_shadow_update(lcd, regs[i].reg, regs[i].value)) {
+            lcd->reg_writes_elided++;
+            continue;
+        }
+        lcd_write_reg(lcd, regs[i].reg, regs[i].value);
+        lcd->reg_writes_issued++;
+    }
+
+    if (open_gram) {
+        uint8_t cmd = ILI9225_GRAM_DATA_REG;
+        gpio_put(lcd->pin_dc, 0);
+        spi_write_blocking(lcd->spi, &cmd, 1);
+        // Pixel data moves the address counter, so the RAM address shadow goes stale
+        lcd_shadow_invalidate(lcd, ILI9225_RAM_ADDR_SET1);
+        lcd_shadow_invalidate(lcd, ILI9225_RAM_ADDR_SET2);
+    }
+}
+
+// Write a register batch under a single CS assertion
+static void lcd_write_regs(ili9225_t* lcd, const ili9225_reg_t* regs, size_t count, bool open_gram) {
+    ili9225_wait_idle(lcd); // Never interleave registers with a running transfer
+    lcd_set_frame_bits(lcd, 8); // Index and register bytes use 8-bit frames
+    lcd_select(lcd);
+    lcd_send_regs(lcd, regs, count, open_gram);
     lcd_deselect(lcd);
 }
 
-// Define the drawing window on the screen
-static void ili9225_set_window(ili9225_t *lcd, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-    ili9225_write_command(lcd, ILI9225_HORIZONTAL_WINDOW_ADDR1);
-    ili9225_write_data16(lcd, x2);
-    ili9225_write_command(lcd, ILI9225_HORIZONTAL_WINDOW_ADDR2);
-    ili9225_write_data16(lcd, x1);
+// Fill the six window/address registers for the given window
+static inline void lcd_window_regs(ili9225_reg_t* regs, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    regs[0] = (ili9225_reg_t){ ILI9225_HORIZONTAL_WINDOW_ADDR1, x2 };
+    regs[1] = (ili9225_reg_t){ ILI9225_HORIZONTAL_WINDOW_ADDR2, x1 };
+    regs[2] = (ili9225_reg_t){ ILI9225_VERTICAL_WINDOW_ADDR1, y2 };
+    regs[3] = (ili9225_reg_t){ ILI9225_VERTICAL_WINDOW_ADDR2, y1 };
+    regs[4] = (ili9225_reg_t){ ILI9225_RAM_ADDR_SET1, x1 };
+    regs[5] = (ili9225_reg_t){ ILI9225_RAM_ADDR_SET2, y1 };
+}
 
-    ili9225_write_command(lcd, ILI9225_VERTICAL_WINDOW_ADDR1);
-    ili9225_write_data16(lcd, y2);
-    ili9225_write_command(lcd, ILI9225_VERTICAL_WINDOW_ADDR2);
-    ili9225_write_data16(lcd, y1);
+void ili9225_write_registers(ili9225_t* lcd, const ili9225_reg_t* regs, size_t count) {
+    if (!lcd || !regs || count == 0) return;
+    lcd_write_regs(lcd, regs, count, false);
+}
 
-    ili9225_write_command(lcd, ILI9225_RAM_ADDR_SET1);
-    ili9225_write_data16(lcd, x1);
-    ili9225_write_command(lcd, ILI9225_RAM_ADDR_SET2);
-    ili9225_write_data16(lcd, y1);
+void ili9225_invalidate_registers(ili9225_t* lcd) {
+    if (!lcd) return;
+    memset(lcd->reg_shadow_valid, 0, sizeof(lcd->reg_shadow_valid));
+}
 
-    ili9225_write_command(lcd, ILI9225_GRAM_DATA_REG);
+// Define the drawing window on the panel, bypassing any framebuffer
+void ili9225_panel_window(ili9225_t *lcd, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    ili9225_reg_t regs[6];
+    lcd_window_regs(regs, x1, y1, x2, y2);
+    lcd_write_regs(lcd, regs, count_of(regs), true);
 }
 
+// Define the drawing window on the screen
+void ili9225_set_window(ili9225_t *lcd, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    if (lcd->framebuffer) {
+        ili9225_fb_window(lcd, x1, y1, x2, y2);
+        return;
+    }
+    ili9225_panel_window(lcd, x1, y1, x2, y2);
+}
+
+// ============================================================================
+// Register Tables
+// ============================================================================
+
+// Power controls cleared before the supply ramps up
+static const ili9225_reg_t init_power_reset[] = {
+    { ILI9225_POWER_CTRL1, 0x0000 },
+    { ILI9225_POWER_CTRL2, 0x0000 },
+    { ILI9225_POWER_CTRL3, 0x0000 },
+    { ILI9225_POWER_CTRL4, 0x0000 },
+    { ILI9225_POWER_CTRL5, 0x0000 },
+};
+
+// Power supply setup
+static const ili9225_reg_t init_power_setup[] = {
+    { ILI9225_POWER_CTRL2, 0x0018 },
+    { ILI9225_POWER_CTRL3, 0x6121 },
+    { ILI9225_POWER_CTRL4, 0x006F },
+    { ILI9225_POWER_CTRL5, 0x495F },
+    { ILI9225_POWER_CTRL1, 0x0800 },
+};
+
+// Step-up circuit enable
+static const ili9225_reg_t init_power_boost[] = {
+    { ILI9225_POWER_CTRL2, 0x103B },
+};
+
+// Panel timing, scan, window and gamma setup; display off (GON/D1)
+static const ili9225_reg_t init_panel[] = {
+    { ILI9225_DRIVER_OUTPUT_CTRL, 0x011C },
+    { ILI9225_LCD_AC_DRIVING_CTRL, 0x0100 },
+    { ILI9225_ENTRY_MODE, 0x1030 }, // Default setting
+    { ILI9225_DISP_CTRL1, 0x0000 },
+    { ILI9225_BLANK_PERIOD_CTRL1, 0x0808 },
+    { ILI9225_FRAME_CYCLE_CTRL, 0x1100 },
+    { ILI9225_INTERFACE_CTRL, 0x0000 },
+    { ILI9225_OSC_CTRL, 0x0D01 },
+    { ILI9225_VCI_RECYCLING, 0x0020 },
+    { ILI9225_RAM_ADDR_SET1, 0x0000 },
+    { ILI9225_RAM_ADDR_SET2, 0x0000 },
+    { ILI9225_GATE_SCAN_CTRL, 0x0000 },
+    { ILI9225_VERTICAL_SCROLL_CTRL1, 0x00DB },
+    { ILI9225_VERTICAL_SCROLL_CTRL2, 0x0000 },
+    { ILI9225_VERTICAL_SCROLL_CTRL3, 0x0000 },
+    { ILI9225_PARTIAL_DRIVING_POS1, 0x00DB },
+    { ILI9225_PARTIAL_DRIVING_POS2, 0x0000 },
+    { ILI9225_HORIZONTAL_WINDOW_ADDR1, 0x00AF },
+    { ILI9225_HORIZONTAL_WINDOW_ADDR2, 0x0000 },
+    { ILI9225_VERTICAL_WINDOW_ADDR1, 0x00DB },
+    { ILI9225_VERTICAL_WINDOW_ADDR2, 0x0000 },
+    // Gamma
+    { ILI9225_GAMMA_CTRL1, 0x0000 },
+    { ILI9225_GAMMA_CTRL2, 0x0808 },
+    { ILI9225_GAMMA_CTRL3, 0x080A },
+    { ILI9225_GAMMA_CTRL4, 0x000A },
+    { ILI9225_GAMMA_CTRL5, 0x0A08 },
+    { ILI9225_GAMMA_CTRL6, 0x0808 },
+    { ILI9225_GAMMA_CTRL7, 0x0000 },
+    { ILI9225_GAMMA_CTRL8, 0x0A00 },
+    { ILI9225_GAMMA_CTRL9, 0x0710 },
+    { ILI9225_GAMMA_CTRL10, 0x0710 },
+    { ILI9225_DISP_CTRL1, 0x0012 },
+};
+
+// Display on
+static const ili9225_reg_t init_display_on[] = {
+    { ILI9225_DISP_CTRL1, 0x1017 },
+};
+
 // ============================================================================
 // Initialization & Control Functions
 // ============================================================================
@@ -81,6 +300,26 @@ void ili9225_init(ili9225_t* lcd) {
         return;
     }
 
+    lcd->dma_busy = false;
+    lcd->framebuffer = NULL; // Immediate mode until a framebuffer is attached
+    lcd->glyph_cache = NULL;
+    lcd->fb_bpp = 16;
+    lcd->fb_stride = 0;
+    lcd->palette = NULL;
+    lcd->fb_y0 = 0;
+    lcd->fb_rows = 0;
+    lcd->dirty_count = 0;
+    lcd->reg_writes_issued = 0;
+    lcd->reg_writes_elided = 0;
+    lcd->origin_x = 0;
+    lcd->origin_y = 0;
+#if ILI9225_TILE_DIFF
+    lcd->tiles_sent = 0;
+    lcd->tiles_skipped = 0;
+#endif
+    ili9225_invalidate_registers(lcd); // Reset below puts every register back to default
+    ili9225_invalidate_tiles(lcd);
+
     // Initialize GPIOs
     gpio_init(lcd->pin_cs);
     gpio_set_dir(lcd->pin_cs, GPIO_OUT);
@@ -97,11 +336,18 @@ void ili9225_init(ili9225_t* lcd) {
     // Initialize SPI
     spi_init(lcd->spi, 30 * 1000 * 1000); // 30 MHz usually works well
     spi_set_format(lcd->spi, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
-    
+    lcd->spi_bits = 8;
+
     gpio_set_function(lcd->pin_sck, GPIO_FUNC_SPI);
     gpio_set_function(lcd->pin_mosi, GPIO_FUNC_SPI);
     // MISO is not used/initialized as ILI9225 in this mode is write-only
 
+    // DMA is optional: without a free channel every fill falls back to the CPU path
+    lcd->dma_chan = dma_claim_unused_channel(false);
+    if (lcd->dma_chan < 0) {
+        LOG_WARN("No free DMA channel, using CPU transfers");
+    }
+
     LOG_DEBUG("SPI initialized. Resetting display...");
 
     // Hardware Reset
@@ -113,110 +359,15 @@ void ili9225_init(ili9225_t* lcd) {
     sleep_ms(50);
 
     // --- Register Initialization Sequence ---
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL1);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL2);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL3);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL4);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL5);
-    ili9225_write_data16(lcd, 0x0000);
-    
+    ili9225_write_registers(lcd, init_power_reset, count_of(init_power_reset));
     sleep_ms(40);
-
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL2);
-    ili9225_write_data16(lcd, 0x0018);
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL3);
-    ili9225_write_data16(lcd, 0x6121);
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL4);
-    ili9225_write_data16(lcd, 0x006F);
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL5);
-    ili9225_write_data16(lcd, 0x495F);
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL1);
-    ili9225_write_data16(lcd, 0x0800);
-    
+    ili9225_write_registers(lcd, init_power_setup, count_of(init_power_setup));
     sleep_ms(10);
-
-    ili9225_write_command(lcd, ILI9225_POWER_CTRL2);
-    ili9225_write_data16(lcd, 0x103B);
-    
+    ili9225_write_registers(lcd, init_power_boost, count_of(init_power_boost));
     sleep_ms(50);
-
-    ili9225_write_command(lcd, ILI9225_DRIVER_OUTPUT_CTRL);
-    ili9225_write_data16(lcd, 0x011C);
-    ili9225_write_command(lcd, ILI9225_LCD_AC_DRIVING_CTRL);
-    ili9225_write_data16(lcd, 0x0100);
-    ili9225_write_command(lcd, ILI9225_ENTRY_MODE);
-    ili9225_write_data16(lcd, 0x1030); // Default setting
-    ili9225_write_command(lcd, ILI9225_DISP_CTRL1);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_BLANK_PERIOD_CTRL1);
-    ili9225_write_data16(lcd, 0x0808);
-    ili9225_write_command(lcd, ILI9225_FRAME_CYCLE_CTRL);
-    ili9225_write_data16(lcd, 0x1100);
-    ili9225_write_command(lcd, ILI9225_INTERFACE_CTRL);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_OSC_CTRL);
-    ili9225_write_data16(lcd, 0x0D01);
-    ili9225_write_command(lcd, ILI9225_VCI_RECYCLING);
-    ili9225_write_data16(lcd, 0x0020);
-    ili9225_write_command(lcd, ILI9225_RAM_ADDR_SET1);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_RAM_ADDR_SET2);
-    ili9225_write_data16(lcd, 0x0000);
-
-    ili9225_write_command(lcd, ILI9225_GATE_SCAN_CTRL);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_VERTICAL_SCROLL_CTRL1);
-    ili9225_write_data16(lcd, 0x00DB);
-    ili9225_write_command(lcd, ILI9225_VERTICAL_SCROLL_CTRL2);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_VERTICAL_SCROLL_CTRL3);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_PARTIAL_DRIVING_POS1);
-    ili9225_write_data16(lcd, 0x00DB);
-    ili9225_write_command(lcd, ILI9225_PARTIAL_DRIVING_POS2);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_HORIZONTAL_WINDOW_ADDR1);
-    ili9225_write_data16(lcd, 0x00AF);
-    ili9225_write_command(lcd, ILI9225_HORIZONTAL_WINDOW_ADDR2);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_VERTICAL_WINDOW_ADDR1);
-    ili9225_write_data16(lcd, 0x00DB);
-    ili9225_write_command(lcd, ILI9225_VERTICAL_WINDOW_ADDR2);
-    ili9225_write_data16(lcd, 0x0000);
-
-    // Gamma
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL1);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL2);
-    ili9225_write_data16(lcd, 0x0808);
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL3);
-    ili9225_write_data16(lcd, 0x080A);
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL4);
-    ili9225_write_data16(lcd, 0x000A);
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL5);
-    ili9225_write_data16(lcd, 0x0A08);
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL6);
-    ili9225_write_data16(lcd, 0x0808);
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL7);
-    ili9225_write_data16(lcd, 0x0000);
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL8);
-    ili9225_write_data16(lcd, 0x0A00);
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL9);
-    ili9225_write_data16(lcd, 0x0710);
-    ili9225_write_command(lcd, ILI9225_GAMMA_CTRL10);
-    ili9225_write_data16(lcd, 0x0710);
-
-    ili9225_write_command(lcd, ILI9225_DISP_CTRL1);
-    ili9225_write_data16(lcd, 0x0012);
-    
+    ili9225_write_registers(lcd, init_panel, count_of(init_panel));
     sleep_ms(50);
-    
-    ili9225_write_command(lcd, ILI9225_DISP_CTRL1);
-    ili9225_write_data16(lcd, 0x1017);
+    ili9225_write_registers(lcd, init_display_on, count_of(init_display_on));
 
     lcd->is_rgb_order = true; // Default assumption
     
@@ -265,10 +416,19 @@ void ili9225_set_orientation(ili9225_t* lcd, ili9225_rotation_t rotation) {
             break;
     }
 
-    ili9225_write_command(lcd, ILI9225_ENTRY_MODE);
-    ili9225_write_data16(lcd, entry_mode);
-    
-    ili9225_set_window(lcd, 0, 0, lcd->width - 1, lcd->height - 1);
+    if (lcd->framebuffer && lcd->fb_y0 == 0) {
+        // A full framebuffer follows the new geometry
+        lcd->fb_rows = lcd->height;
+        lcd->fb_stride = (lcd->fb_bpp == 16) ? lcd->width * 2 : ILI9225_INDEXED_ROW_BYTES(lcd->width, lcd->fb_bpp);
+    }
+    ili9225_invalidate_tiles(lcd); // The tile grid moved with the geometry
+    ili9225_reset_clip(lcd);       // Clips were in the old screen coordinates
+
+    // Entry mode and the full-screen window go out as one batch
+    ili9225_reg_t regs[7];
+    regs[0] = (ili9225_reg_t){ ILI9225_ENTRY_MODE, entry_mode };
+    lcd_window_regs(&regs[1], 0, 0, lcd->width - 1, lcd->height - 1);
+    lcd_write_regs(lcd, regs, count_of(regs), true);
 }
 
 void ili9225_set_color_order(ili9225_t* lcd, bool is_rgb) {
@@ -278,230 +438,1045 @@ void ili9225_set_color_order(ili9225_t* lcd, bool is_rgb) {
     ili9225_set_orientation(lcd, lcd->rotation);
 }
 
+bool ili9225_is_busy(ili9225_t* lcd) {
+    if (!lcd || !lcd->dma_busy) return false;
+    if (dma_channel_is_busy(lcd->dma_chan) || spi_is_busy(lcd->spi)) return true;
+
+    lcd_dma_finish(lcd);
+    return false;
+}
+
+void ili9225_wait_idle(ili9225_t* lcd) {
+    if (lcd && lcd->dma_busy) {
+        lcd_dma_finish(lcd);
+    }
+}
+
 void ili9225_refresh_display(ili9225_t* lcd) {
     // ILI9225 doesn't have a specific "flush" command for internal GRAM to Panel
     // It updates automatically. This function usually just clears artifacts.
     ili9225_set_window(lcd, 0, 0, lcd->width - 1, lcd->height - 1);
 }
 
+// ============================================================================
+// Clipping & Translation
+// ============================================================================
+
+void ili9225_set_origin(ili9225_t* lcd, int16_t x, int16_t y) {
+    if (!lcd) return;
+    lcd->origin_x = x;
+    lcd->origin_y = y;
+}
+
+bool ili9225_push_clip(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    if (!lcd) return false;
+    if (lcd->clip_depth >= ILI9225_CLIP_STACK_DEPTH) {
+        LOG_WARN("push_clip: stack full (%u)", ILI9225_CLIP_STACK_DEPTH);
+        return false;
+    }
+    lcd->clip_stack[lcd->clip_depth++] = lcd->clip;
+
+    // Intersect with the current clip in screen coordinates
+    int32_t x1 = (int32_t)x + lcd->origin_x;
+    int32_t y1 = (int32_t)y + lcd->origin_y;
+    int32_t x2 = x1 + w;
+    int32_t y2 = y1 + h;
+    if (x1 < lcd->clip.x) x1 = lcd->clip.x;
+    if (y1 < lcd->clip.y) y1 = lcd->clip.y;
+    if (x2 > lcd->clip.x + lcd->clip.w) x2 = lcd->clip.x + lcd->clip.w;
+    if (y2 > lcd->clip.y + lcd->clip.h) y2 = lcd->clip.y + lcd->clip.h;
+    if (x2 < x1) x2 = x1;
+    if (y2 < y1) y2 = y1;
+
+    lcd->clip = (ili9225_rect_t){ (int16_t)x1, (int16_t)y1, (uint16_t)(x2 - x1), (uint16_t)(y2 - y1) };
+    return true;
+}
+
+void ili9225_pop_clip(ili9225_t* lcd) {
+    if (!lcd || lcd->clip_depth == 0) return;
+    lcd->clip = lcd->clip_stack[--lcd->clip_depth];
+}
+
+void ili9225_reset_clip(ili9225_t* lcd) {
+    if (!lcd) return;
+    lcd->clip_depth = 0;
+    lcd->clip = (ili9225_rect_t){ 0, 0, lcd->width, lcd->height };
+}
+
+// Drawing coordinates to screen coordinates
+static inline int32_t lcd_sx(const ili9225_t* lcd, int32_t x) {
+    return x + lcd->origin_x;
+}
+
+static inline int32_t lcd_sy(const ili9225_t* lcd, int32_t y) {
+    return y + lcd->origin_y;
+}
+
+// Clip a screen rectangle given as [x1, x2) x [y1, y2); false when nothing is left
+static inline bool lcd_clip_box(const lcd_clip_t* c, int32_t* x1, int32_t* y1, int32_t* x2, int32_t* y2) {
+    if (*x1 < c->x1) *x1 = c->x1;
+    if (*y1 < c->y1) *y1 = c->y1;
+    if (*x2 > c->x2) *x2 = c->x2;
+    if (*y2 > c->y2) *y2 = c->y2;
+    return *x1 < *x2 && *y1 < *y2;
+}
+
 // ============================================================================
 // Graphic Primitives
 // ============================================================================
 
+// Write one pixel at screen coordinates the caller has already clipped
+static void lcd_pixel(ili9225_t* lcd, uint16_t x, uint16_t y, uint16_t color) {
+    if (lcd->framebuffer) {
+        ili9225_fb_window(lcd, x, y, x, y);
+        ili9225_fb_store(lcd, x, y - lcd->fb_y0, &color, 1, false);
+        return;
+    }
+    
+    // Keep the full-screen window so consecutive pixels only re-send the RAM address;
+    // the shadow elides the unchanged window registers.
+    ili9225_reg_t regs[6];
+    lcd_window_regs(regs, 0, 0, lcd->width - 1, lcd->height - 1);
+    regs[4].value = x;
+    regs[5].value = y;
+    lcd_write_regs(lcd, regs, count_of(regs), true);
+    ili9225_panel_stream(lcd, &color, 1, false, true);
+}
+
+void ili9225_plot(ili9225_t* lcd, int32_t x, int32_t y, uint16_t color) {
+    lcd_clip_t c = lcd_clip(lcd);
+    if (x < c.x1 || x >= c.x2 || y < c.y1 || y >= c.y2) return;
+    lcd_pixel(lcd, (uint16_t)x, (uint16_t)y, color);
+}
+
+void ili9225_draw_pixel(ili9225_t* lcd, int16_t x, int16_t y, uint16_t color) {
+    ili9225_plot(lcd, lcd_sx(lcd, x), lcd_sy(lcd, y), color);
+}
+
+// Insertion sort: linear when points already arrive in row order, as plots usually do
+static void lcd_sort_keys(uint32_t* keys, size_t count) {
+    for (size_t i = 1; i < count; i++) {
+        uint32_t key = keys[i];
+        size_t j = i;
+        while (j > 0 && keys[j - 1] > key) {
+            keys[j] = keys[j - 1];
+            j--;
+        }
+        keys[j] = key;
+    }
+}
+
+// Does the address counter step left to right along a row (entry mode AM = 0, ID0 = 1)?
+static bool lcd_gram_row_major(const ili9225_t* lcd) {
+    if (!lcd_shadow_valid(lcd, ILI9225_ENTRY_MODE)) return false;
+    return (lcd->reg_shadow[ILI9225_ENTRY_MODE] & 0x0018) == 0x0010;
+}
+
+// Send one run of a pixel batch along screen row y from column x. The window
+// is the full screen, as in lcd_pixel, unless the address counter does not
+// step along rows; runs then get a window spanning just their row. Either
+// way consecutive runs mostly change only the RAM address.
+// With `held` CS is already asserted and stays asserted.
+static void lcd_pixel_run(ili9225_t* lcd, uint16_t x, uint16_t y, const uint16_t* colors,
+                          uint32_t count, bool held) {
+    ili9225_reg_t regs[6];
+    if (count > 1 && !lcd_gram_row_major(lcd)) {
+        lcd_window_regs(regs, 0, y, lcd->width - 1, y);
+    } else {
+        lcd_window_regs(regs, 0, 0, lcd->width - 1, lcd->height - 1);
+    }
+    regs[4].value = x;
+    regs[5].value = y;
+
+    if (!held) {
+        lcd_write_regs(lcd, regs, count_of(regs), true);
+        ili9225_panel_stream(lcd, colors, count, true, true);
+        return;
+    }
+    lcd_set_frame_bits(lcd, 8);
+    lcd_send_regs(lcd, regs, count_of(regs), true);
+    gpio_put(lcd->pin_dc, 1); // Data
+    lcd_set_frame_bits(lcd, 16);
+    spi_write16_blocking(lcd->spi, colors, count);
+}
+
+void ili9225_draw_pixels(ili9225_t* lcd, const ili9225_point_t* points, const uint16_t* colors,
+                         size_t count, uint8_t flags) {
+    if (!lcd || !points || !colors) return;
+
+    // Framebuffer stores are cheap per pixel; nothing to gain from sorting
+    if (lcd->framebuffer) {
+        for (size_t i = 0; i < count; i++) {
+            ili9225_plot(lcd, lcd_sx(lcd, points[i].x), lcd_sy(lcd, points[i].y), colors[i]);
+        }
+        return;
+    }
+
+    bool held = (flags & ILI9225_PIXELS_HOLD_CS) != 0;
+    if (held) {
+        ili9225_wait_idle(lcd);
+        lcd_select(lcd);
+    }
+
+    lcd_clip_t c = lcd_clip(lcd);
+    uint32_t keys[ILI9225_PIXELS_CHUNK];
+    uint16_t run[64];
+    for (size_t base = 0; base < count; base += ILI9225_PIXELS_CHUNK) {
+        size_t end = (count - base < ILI9225_PIXELS_CHUNK) ? count : base + ILI9225_PIXELS_CHUNK;
+
+        // Sort key: row, column, then position in the batch so later points win
+        size_t n = 0;
+        for (size_t i = base; i < end; i++) {
+            int32_t x = lcd_sx(lcd, points[i].x), y = lcd_sy(lcd, points[i].y);
+            if (x < c.x1 || x >= c.x2 || y < c.y1 || y >= c.y2) continue;
+            keys[n++] = ((uint32_t)y << 24) | ((uint32_t)x << 16) | (uint32_t)(i - base);
+        }
+        lcd_sort_keys(keys, n);
+
+        // Adjacent columns on a row are coalesced into one auto-incrementing run
+        uint16_t run_x = 0, run_y = 0;
+        uint32_t len = 0;
+        for (size_t k = 0; k < n; k++) {
+            uint16_t x = (keys[k] >> 16) & 0xFF, y = keys[k] >> 24;
+            uint16_t color = colors[base + (keys[k] & 0xFFFF)];
+            if (len > 0 && y == run_y && x == run_x + len - 1) {
+                run[len - 1] = color; // Same pixel again
+                continue;
+            }
+            if (len > 0 && (y != run_y || x != run_x + len || len == count_of(run))) {
+                lcd_pixel_run(lcd, run_x, run_y, run, len, held);
+                len = 0;
+            }
+            if (len == 0) {
+                run_x = x;
+                run_y = y;
+            }
+            run[len++] = color;
+        }
+        if (len > 0) {
+            lcd_pixel_run(lcd, run_x, run_y, run, len, held);
+        }
+    }
+
+    if (held) {
+        lcd_deselect(lcd);
+    }
+}
+
+// Fill a rectangle given in screen coordinates, clipped to the clip rectangle
+static void lcd_fill_rect(ili9225_t* lcd, int32_t x, int32_t y, int32_t w, int32_t h,
+                          uint16_t color, bool wait) {
+    lcd_clip_t c = lcd_clip(lcd);
+    int32_t x2 = x + w, y2 = y + h;
+    if (!lcd_clip_box(&c, &x, &y, &x2, &y2)) return;
+
+    ili9225_set_window(lcd, x, y, x2 - 1, y2 - 1);
+    lcd_fill_pixels(lcd, color, (uint32_t)(x2 - x) * (y2 - y), wait);
+}
+
+// Screen coordinates: the origin does not apply, the clip does
 void ili9225_fill_screen(ili9225_t* lcd, uint16_t color) {
-    ili9225_fill_rect(lcd, 0, 0, lcd->width, lcd->height, color);
+    lcd_fill_rect(lcd, 0, 0, lcd->width, lcd->height, color, true);
 }
 
-void ili9225_draw_pixel(ili9225_t* lcd, uint16_t x, uint16_t y, uint16_t color) {
-    if (x >= lcd->width || y >= lcd->height) return;
-    
-    ili9225_set_window(lcd, x, y, x, y);
-    ili9225_write_data16(lcd, color);
+void ili9225_fill_screen_async(ili9225_t* lcd, uint16_t color) {
+    lcd_fill_rect(lcd, 0, 0, lcd->width, lcd->height, color, false);
+}
+
+void ili9225_draw_hline(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t color) {
+    lcd_fill_rect(lcd, lcd_sx(lcd, x), lcd_sy(lcd, y), w, 1, color, true);
+}
+
+void ili9225_draw_vline(ili9225_t* lcd, int16_t x, int16_t y, uint16_t h, uint16_t color) {
+    lcd_fill_rect(lcd, lcd_sx(lcd, x), lcd_sy(lcd, y), 1, h, color, true);
 }
 
-void ili9225_draw_line(ili9225_t* lcd, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
-    int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+// Cohen-Sutherland outcode of a screen point against the clip
+enum { OUT_LEFT = 1, OUT_RIGHT = 2, OUT_TOP = 4, OUT_BOTTOM = 8 };
+
+static inline uint8_t lcd_outcode(const lcd_clip_t* c, int32_t x, int32_t y) {
+    uint8_t code = 0;
+    if (x < c->x1) code |= OUT_LEFT;
+    else if (x >= c->x2) code |= OUT_RIGHT;
+    if (y < c->y1) code |= OUT_TOP;
+    else if (y >= c->y2) code |= OUT_BOTTOM;
+    return code;
+}
+
+void ili9225_draw_line(ili9225_t* lcd, int16_t ux0, int16_t uy0, int16_t ux1, int16_t uy1, uint16_t color) {
+    int32_t x0 = lcd_sx(lcd, ux0), y0 = lcd_sy(lcd, uy0);
+    int32_t x1 = lcd_sx(lcd, ux1), y1 = lcd_sy(lcd, uy1);
+
+    // Both ends beyond the same clip edge: nothing to walk
+    lcd_clip_t c = lcd_clip(lcd);
+    uint8_t code0 = lcd_outcode(&c, x0, y0), code1 = lcd_outcode(&c, x1, y1);
+    if (code0 & code1) return;
+
+    // Axis-aligned lines are a single burst
+    if (y0 == y1 || x0 == x1) {
+        int32_t bx = x0 < x1 ? x0 : x1, by = y0 < y1 ? y0 : y1;
+        lcd_fill_rect(lcd, bx, by, abs(x1 - x0) + 1, abs(y1 - y0) + 1, color, true);
+        return;
+    }
+
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    int32_t major1 = c.x1, major2 = c.x2, minor1 = c.y1, minor2 = c.y2;
     if (steep) {
         // swap x0, y0
-        uint16_t temp = x0; x0 = y0; y0 = temp;
+        int32_t temp = x0; x0 = y0; y0 = temp;
         // swap x1, y1
         temp = x1; x1 = y1; y1 = temp;
+        major1 = c.y1; major2 = c.y2; minor1 = c.x1; minor2 = c.x2;
     }
 
     if (x0 > x1) {
         // swap x0, x1
-        uint16_t temp = x0; x0 = x1; x1 = temp;
+        int32_t temp = x0; x0 = x1; x1 = temp;
         // swap y0, y1
         temp = y0; y0 = y1; y1 = temp;
     }
 
-    int16_t dx = x1 - x0;
-    int16_t dy = abs(y1 - y0);
-    int16_t err = dx / 2;
-    int16_t ystep = (y0 < y1) ? 1 : -1;
-
-    for (; x0 <= x1; x0++) {
-        if (steep) {
-            ili9225_draw_pixel(lcd, y0, x0, color);
-        } else {
-            ili9225_draw_pixel(lcd, x0, y0, color);
+    int32_t dx = x1 - x0;
+    int32_t dy = abs(y1 - y0);
+    int32_t ystep = (y0 < y1) ? 1 : -1;
+
+    // Step i (0..dx) plots minor coordinate y0 + ystep * m(i), where
+    // m(i) = ceil((i * dy - dx / 2) / dx), clamped at 0. Both are monotonic in i, so the
+    // steps inside the clip form one range, found without walking the line
+    // (Liang-Barsky on the integer line, so the visible pixels match the unclipped line).
+    int32_t i_first = 0, i_last = dx;
+    if (code0 | code1) {
+        if (major1 - x0 > i_first) i_first = major1 - x0;
+        if (major2 - 1 - x0 < i_last) i_last = major2 - 1 - x0;
+
+        // Allowed minor steps m in [m_lo, m_hi]
+        int64_t m_lo = (ystep > 0) ? minor1 - y0 : y0 - (minor2 - 1);
+        int64_t m_hi = (ystep > 0) ? minor2 - 1 - y0 : y0 - minor1;
+        if (m_hi < 0) return;
+        if (m_lo > 0) {
+            // m(i) >= m_lo  <=>  i * dy > (m_lo - 1) * dx + dx / 2
+            int64_t i = ((m_lo - 1) * dx + dx / 2) / dy + 1;
+            if (i > i_first) i_first = (int32_t)(i > dx + 1 ? dx + 1 : i);
         }
+        // m(i) <= m_hi  <=>  i * dy <= m_hi * dx + dx / 2
+        int64_t i = (m_hi * dx + dx / 2) / dy;
+        if (i < i_last) i_last = (int32_t)i;
+        if (i_first > i_last) return;
+    }
+
+    // Bresenham state at the first visible step
+    int64_t m = ((int64_t)i_first * dy - dx / 2 + dx - 1) / dx;
+    if (m < 0) m = 0;
+    int32_t err = (int32_t)(dx / 2 - (int64_t)i_first * dy + m * dx);
+    int32_t y = y0 + ystep * (int32_t)m;
+    int32_t x = x0 + i_first, x_end = x0 + i_last;
+
+    // Bresenham, but pixels sharing a minor-axis coordinate are collected into
+    // a run and sent as one window burst instead of one window per pixel.
+    int32_t run_start = x;
+    for (; x <= x_end; x++) {
         err -= dy;
+        if (err < 0 || x == x_end) {
+            int32_t len = x - run_start + 1;
+            if (steep) {
+                lcd_fill_rect(lcd, y, run_start, 1, len, color, true);
+            } else {
+                lcd_fill_rect(lcd, run_start, y, len, 1, color, true);
+            }
+            run_start = x + 1;
+        }
         if (err < 0) {
-            y0 += ystep;
+            y += ystep;
             err += dx;
         }
     }
 }
 
-void ili9225_draw_rect(ili9225_t* lcd, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    ili9225_draw_line(lcd, x, y, x + w - 1, y, color);
-    ili9225_draw_line(lcd, x, y + h - 1, x + w - 1, y + h - 1, color);
-    ili9225_draw_line(lcd, x, y, x, y + h - 1, color);
-    ili9225_draw_line(lcd, x + w - 1, y, x + w - 1, y + h - 1, color);
+void ili9225_draw_rect(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (w == 0 || h == 0) return;
+    ili9225_draw_hline(lcd, x, y, w, color);
+    ili9225_draw_hline(lcd, x, y + h - 1, w, color);
+    if (h > 2) {
+        ili9225_draw_vline(lcd, x, y + 1, h - 2, color);
+        ili9225_draw_vline(lcd, x + w - 1, y + 1, h - 2, color);
+    }
 }
 
-void ili9225_fill_rect(ili9225_t* lcd, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    if (x >= lcd->width || y >= lcd->height) return;
-    if ((x + w) > lcd->width) w = lcd->width - x;
-    if ((y + h) > lcd->height) h = lcd->height - y;
+void ili9225_fill_rect(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    lcd_fill_rect(lcd, lcd_sx(lcd, x), lcd_sy(lcd, y), w, h, color, true);
+}
 
-    ili9225_set_window(lcd, x, y, x + w - 1, y + h - 1);
-    
-    gpio_put(lcd->pin_dc, 1); // Data
-    lcd_select(lcd);
+void ili9225_fill_rect_async(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    lcd_fill_rect(lcd, lcd_sx(lcd, x), lcd_sy(lcd, y), w, h, color, false);
+}
 
-    uint32_t total_pixels = (uint32_t)w * h;
-    uint8_t color_hi = color >> 8;
-    uint8_t color_lo = color & 0xFF;
-    
-    // Write pixel by pixel.
-    // Optimization note: Creating a larger buffer (e.g. 64 bytes) and sending chunks
-    // is much faster than looping spi_write_blocking for 2 bytes at a time.
-    uint8_t line_buf[2] = { color_hi, color_lo };
-    
-    for(uint32_t i = 0; i < total_pixels; i++) {
-        spi_write_blocking(lcd->spi, line_buf, 2);
-    }
+// Fixed-point (16.16) helpers for the scanline fillers; 64-bit so edges
+// between far off-screen signed coordinates cannot overflow
+#define FP_SHIFT 16
+#define FP_FROM_INT(v) ((int64_t)(v) * (1 << FP_SHIFT))
+#define FP_ROUND(v) (((v) + (1 << (FP_SHIFT - 1))) >> FP_SHIFT)
 
-    lcd_deselect(lcd);
+// Fill the inclusive span [xa, xb] on screen row y, clipped
+static void lcd_fill_span(ili9225_t* lcd, int32_t xa, int32_t xb, int32_t y, uint16_t color) {
+    if (xa > xb) { int32_t temp = xa; xa = xb; xb = temp; }
+    lcd_fill_rect(lcd, xa, y, xb - xa + 1, 1, color, true);
 }
 
-void ili9225_draw_circle(ili9225_t* lcd, uint16_t x0, uint16_t y0, uint16_t r, uint16_t color) {
-    int16_t f = 1 - r;
-    int16_t ddF_x = 1;
-    int16_t ddF_y = -2 * r;
-    int16_t x = 0;
-    int16_t y = r;
+// Rows y0 +/- dy of a shape of half-height r centred on screen row y0 that
+// fall inside the clip: dy in [*dy_min, *dy_max]. False if there are none.
+static bool lcd_clip_rows(const lcd_clip_t* c, int32_t y0, int32_t r, int32_t* dy_min, int32_t* dy_max) {
+    if (y0 < c->y1) *dy_min = c->y1 - y0;
+    else if (y0 >= c->y2) *dy_min = y0 - c->y2 + 1;
+    else *dy_min = 0;
+
+    int32_t up = y0 - c->y1, down = c->y2 - 1 - y0;
+    *dy_max = up > down ? up : down;
+    if (*dy_max > r) *dy_max = r;
+    return *dy_min <= *dy_max;
+}
+
+// Is any part of the box [x - rx, x + rx] x [y - ry, y + ry] inside the clip?
+static bool lcd_clip_hits(const lcd_clip_t* c, int32_t x, int32_t y, int32_t rx, int32_t ry) {
+    return x + rx >= c->x1 && x - rx < c->x2 && y + ry >= c->y1 && y - ry < c->y2;
+}
+
+static uint32_t lcd_isqrt(uint64_t v) {
+    uint64_t root = 0;
+    uint64_t bit = 1ull << 62;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
 
-    ili9225_draw_pixel(lcd, x0, y0 + r, color);
-    ili9225_draw_pixel(lcd, x0, y0 - r, color);
-    ili9225_draw_pixel(lcd, x0 + r, y0, color);
-    ili9225_draw_pixel(lcd, x0 - r, y0, color);
+// Plot (x0 +/- dx, y0 +/- dy), skipping mirrors outside the clip
+static void lcd_plot_mirrors(ili9225_t* lcd, const lcd_clip_t* c, int32_t x0, int32_t y0,
+                             int32_t dx, int32_t dy, uint16_t color) {
+    bool left = dx > 0 && x0 - dx >= c->x1 && x0 - dx < c->x2;
+    bool right = x0 + dx >= c->x1 && x0 + dx < c->x2;
+    if (!left && !right) return;
+
+    for (int side = 0; side < 2; side++) {
+        if (side == 1 && dy == 0) break;
+        int32_t y = side ? y0 - dy : y0 + dy;
+        if (y < c->y1 || y >= c->y2) continue;
+        if (right) lcd_pixel(lcd, (uint16_t)(x0 + dx), (uint16_t)y, color);
+        if (left) lcd_pixel(lcd, (uint16_t)(x0 - dx), (uint16_t)y, color);
+    }
+}
 
-    while (x < y) {
+// Midpoint outline steps x = xa..xb of one octant of a circle of radius r.
+// Step x is on row y, plotted as (+/-x, +/-y), or as (+/-y, +/-x) if swap.
+static void lcd_circle_steps(ili9225_t* lcd, const lcd_clip_t* c, int32_t x0, int32_t y0, int32_t r,
+                             int32_t xa, int32_t xb, bool swap, uint16_t color) {
+    // Before the last step y is the largest row with x^2 + y^2 - y < r^2;
+    // start one step early so the walk itself makes the last one
+    int32_t x = xa > 0 ? xa - 1 : 0;
+    int64_t r2 = (int64_t)r * r;
+    int32_t y = x == 0 ? r : (int32_t)((lcd_isqrt(4 * (r2 - (int64_t)x * x) - 3) + 1) / 2);
+    int64_t f = (int64_t)(x + 1) * (x + 1) + (int64_t)y * y - y - r2;
+
+    for (; x <= xb; x++) {
+        if (x >= xa) {
+            if (swap) lcd_plot_mirrors(lcd, c, x0, y0, y, x, color);
+            else lcd_plot_mirrors(lcd, c, x0, y0, x, y, color);
+        }
         if (f >= 0) {
             y--;
-            ddF_y += 2;
-            f += ddF_y;
+            f -= 2 * y;
         }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
+        f += 2 * (x + 1) + 1;
+    }
+}
 
-        ili9225_draw_pixel(lcd, x0 + x, y0 + y, color);
-        ili9225_draw_pixel(lcd, x0 - x, y0 + y, color);
-        ili9225_draw_pixel(lcd, x0 + x, y0 - y, color);
-        ili9225_draw_pixel(lcd, x0 - x, y0 - y, color);
-        ili9225_draw_pixel(lcd, x0 + y, y0 + x, color);
-        ili9225_draw_pixel(lcd, x0 - y, y0 + x, color);
-        ili9225_draw_pixel(lcd, x0 + y, y0 - x, color);
-        ili9225_draw_pixel(lcd, x0 - y, y0 - x, color);
+void ili9225_draw_circle(ili9225_t* lcd, int16_t ux0, int16_t uy0, uint16_t r, uint16_t color) {
+    int32_t x0 = lcd_sx(lcd, ux0), y0 = lcd_sy(lcd, uy0);
+    lcd_clip_t c = lcd_clip(lcd);
+    int32_t dy_min, dy_max;
+    if (!lcd_clip_hits(&c, x0, y0, r, r) || !lcd_clip_rows(&c, y0, r, &dy_min, &dy_max)) return;
+
+    // The octant runs from x = 0 to the first step n with x >= y, which is
+    // the first with 2n^2 + n >= r^2
+    int64_t r2 = (int64_t)r * r;
+    int32_t n = (int32_t)lcd_isqrt(r2 / 2);
+    while (2 * (int64_t)n * n + n < r2) n++;
+
+    // Rows y0 +/- x: only steps dy_min..dy_max can reach the clip
+    if (dy_min <= n) {
+        lcd_circle_steps(lcd, &c, x0, y0, r, dy_min, dy_max < n ? dy_max : n, true, color);
     }
+
+    // Rows y0 +/- y: y falls as x grows. It is at most D from
+    // x^2 >= r^2 - D(D+1) on, and at least D while x^2 < r^2 - D(D-1).
+    int32_t xa = 0, xb = n;
+    int64_t below = r2 - (int64_t)dy_max * (dy_max + 1);
+    if (below > 0) {
+        xa = (int32_t)lcd_isqrt(below);
+        if ((int64_t)xa * xa < below) xa++;
+    }
+    if (dy_min > 0) {
+        // One more: the last step can stay a row above the bound
+        int32_t last = (int32_t)lcd_isqrt(r2 - (int64_t)dy_min * (dy_min - 1) - 1) + 1;
+        if (last < xb) xb = last;
+    }
+    if (xa <= xb) lcd_circle_steps(lcd, &c, x0, y0, r, xa, xb, false, color);
 }
 
-void ili9225_fill_circle(ili9225_t* lcd, uint16_t x0, uint16_t y0, uint16_t r, uint16_t color) {
-    ili9225_draw_line(lcd, x0, y0 - r, x0, y0 + r, color); // Center vertical line
-    
-    int16_t f = 1 - r;
-    int16_t ddF_x = 1;
-    int16_t ddF_y = -2 * r;
-    int16_t x = 0;
-    int16_t y = r;
+// Incremental row generator for filled ellipses and circles. For successive
+// dy = 0..ry it yields the half-width of the row, i.e. the largest dx with
+// dx^2*ry^2 + dy^2*rx^2 <= rx^2*ry^2 + rx*ry*(rx+ry)/2. For a circle this is
+// x^2 + y^2 <= r^2 + r, the same boundary the midpoint outline follows.
+typedef struct {
+    int64_t rx2;
+    int64_t ry2;
+    int64_t limit;
+    int32_t dx;
+} span_gen_t;
+
+static void span_gen_init(span_gen_t* g, int32_t rx, int32_t ry) {
+    g->rx2 = (int64_t)rx * rx;
+    g->ry2 = (int64_t)ry * ry;
+    g->limit = g->rx2 * g->ry2 + (int64_t)rx * ry * (rx + ry) / 2;
+    g->dx = rx;
+}
 
-    while (x < y) {
-        if (f >= 0) {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
+// dy must not decrease between calls. Returns -1 once the row is outside.
+static int32_t span_gen_next(span_gen_t* g, int32_t dy) {
+    int64_t row = (int64_t)dy * dy * g->rx2;
+    while (g->dx >= 0 && (int64_t)g->dx * g->dx * g->ry2 + row > g->limit) {
+        g->dx--;
+    }
+    return g->dx;
+}
+
+void ili9225_fill_ellipse(ili9225_t* lcd, int16_t ux0, int16_t uy0, uint16_t rx, uint16_t ry, uint16_t color) {
+    int32_t x0 = lcd_sx(lcd, ux0), y0 = lcd_sy(lcd, uy0);
+    lcd_clip_t c = lcd_clip(lcd);
+    int32_t dy_min, dy_max;
+    if (!lcd_clip_hits(&c, x0, y0, rx, ry) || !lcd_clip_rows(&c, y0, ry, &dy_min, &dy_max)) return;
+
+    // Each row is computed once and sent as one burst; the two halves mirror
+    span_gen_t gen;
+    span_gen_init(&gen, rx, ry);
+
+    for (int32_t dy = dy_min; dy <= dy_max; dy++) {
+        int32_t dx = span_gen_next(&gen, dy);
+        if (dx < 0) break;
+        lcd_fill_span(lcd, x0 - dx, x0 + dx, y0 + dy, color);
+        if (dy > 0) {
+            lcd_fill_span(lcd, x0 - dx, x0 + dx, y0 - dy, color);
         }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
+    }
+}
 
-        ili9225_draw_line(lcd, x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ili9225_draw_line(lcd, x0 - x, y0 - y, x0 + x, y0 - y, color);
-        ili9225_draw_line(lcd, x0 - y, y0 + x, x0 + y, y0 + x, color);
-        ili9225_draw_line(lcd, x0 - y, y0 - x, x0 + y, y0 - x, color);
+void ili9225_fill_circle(ili9225_t* lcd, int16_t x0, int16_t y0, uint16_t r, uint16_t color) {
+    ili9225_fill_ellipse(lcd, x0, y0, r, r, color);
+}
+
+void ili9225_fill_ring(ili9225_t* lcd, int16_t ux0, int16_t uy0, uint16_t r_outer, uint16_t r_inner, uint16_t color) {
+    if (r_inner >= r_outer) return;
+    int32_t x0 = lcd_sx(lcd, ux0), y0 = lcd_sy(lcd, uy0);
+    lcd_clip_t c = lcd_clip(lcd);
+    int32_t dy_min, dy_max;
+    if (!lcd_clip_hits(&c, x0, y0, r_outer, r_outer) || !lcd_clip_rows(&c, y0, r_outer, &dy_min, &dy_max)) return;
+
+    // The hole matches ili9225_fill_circle(r_inner) exactly, so a ring plus
+    // a filled inner circle covers the same pixels as the outer circle.
+    span_gen_t outer, inner;
+    span_gen_init(&outer, r_outer, r_outer);
+    span_gen_init(&inner, r_inner, r_inner);
+
+    for (int32_t dy = dy_min; dy <= dy_max; dy++) {
+        int32_t dxo = span_gen_next(&outer, dy);
+        if (dxo < 0) break;
+        int32_t dxi = (dy <= r_inner) ? span_gen_next(&inner, dy) : -1;
+
+        for (int side = 0; side < 2; side++) {
+            if (side == 1 && dy == 0) break;
+            int32_t y = side ? y0 - dy : y0 + dy;
+            if (dxi < 0) {
+                lcd_fill_span(lcd, x0 - dxo, x0 + dxo, y, color);
+            } else if (dxo > dxi) {
+                lcd_fill_span(lcd, x0 - dxo, x0 - dxi - 1, y, color);
+                lcd_fill_span(lcd, x0 + dxi + 1, x0 + dxo, y, color);
+            }
+        }
     }
 }
 
-void ili9225_draw_triangle(ili9225_t* lcd, uint16_t x0, uint16_t y0,
-                           uint16_t x1, uint16_t y1,
-                           uint16_t x2, uint16_t y2, uint16_t color) {
+void ili9225_draw_triangle(ili9225_t* lcd, int16_t x0, int16_t y0,
+                           int16_t x1, int16_t y1,
+                           int16_t x2, int16_t y2, uint16_t color) {
     ili9225_draw_line(lcd, x0, y0, x1, y1, color);
     ili9225_draw_line(lcd, x1, y1, x2, y2, color);
     ili9225_draw_line(lcd, x2, y2, x0, y0, color);
 }
 
-void ili9225_fill_triangle(ili9225_t* lcd, uint16_t x0, uint16_t y0,
-                           uint16_t x1, uint16_t y1,
-                           uint16_t x2, uint16_t y2, uint16_t color) {
-    // Standard scan-line triangle filling algorithm is complex.
-    // For a minimal embedded driver, drawing the outline is often sufficient placeholder.
-    // Or iterate bounding box and checking barycentric coords.
-    // Leaving as outline for now to save flash space.
-    ili9225_draw_triangle(lcd, x0, y0, x1, y1, x2, y2, color);
+void ili9225_fill_triangle(ili9225_t* lcd, int16_t ux0, int16_t uy0,
+                           int16_t ux1, int16_t uy1,
+                           int16_t ux2, int16_t uy2, uint16_t color) {
+    int32_t x0 = lcd_sx(lcd, ux0), y0 = lcd_sy(lcd, uy0);
+    int32_t x1 = lcd_sx(lcd, ux1), y1 = lcd_sy(lcd, uy1);
+    int32_t x2 = lcd_sx(lcd, ux2), y2 = lcd_sy(lcd, uy2);
+
+    // Sort vertices by Y (y0 <= y1 <= y2)
+    if (y0 > y1) { int32_t t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+    if (y1 > y2) { int32_t t = y1; y1 = y2; y2 = t; t = x1; x1 = x2; x2 = t; }
+    if (y0 > y1) { int32_t t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+
+    int32_t xmin = x0, xmax = x0;
+    if (x1 < xmin) xmin = x1;
+    if (x1 > xmax) xmax = x1;
+    if (x2 < xmin) xmin = x2;
+    if (x2 > xmax) xmax = x2;
+
+    lcd_clip_t c = lcd_clip(lcd);
+    if (xmax < c.x1 || xmin >= c.x2 || y2 < c.y1 || y0 >= c.y2) return;
+
+    if (y0 == y2) {
+        // Degenerate: all vertices on one row
+        lcd_fill_span(lcd, xmin, xmax, y0, color);
+        return;
+    }
+
+    // Only rows inside the clip are stepped; edges start at the first of them
+    int32_t y_first = y0 < c.y1 ? c.y1 : y0;
+    int32_t y_last = y2 >= c.y2 ? c.y2 - 1 : y2;
+
+    // Long edge 0->2 spans every row; the short edges 0->1 and 1->2 split it
+    int64_t step_long = FP_FROM_INT(x2 - x0) / (y2 - y0);
+    int64_t x_long = FP_FROM_INT(x0) + step_long * (y_first - y0);
+    int32_t y = y_first;
+
+    // Upper part. Row y1 belongs here only if the bottom is flat.
+    int32_t last = (y1 == y2) ? y1 : y1 - 1;
+    if (last > y_last) last = y_last;
+    if (y1 > y0) {
+        int64_t step = FP_FROM_INT(x1 - x0) / (y1 - y0);
+        int64_t x_short = FP_FROM_INT(x0) + step * (y - y0);
+        for (; y <= last; y++) {
+            lcd_fill_span(lcd, (int32_t)FP_ROUND(x_short), (int32_t)FP_ROUND(x_long), y, color);
+            x_short += step;
+            x_long += step_long;
+        }
+    }
+
+    // Lower part
+    if (y2 > y1) {
+        int64_t step = FP_FROM_INT(x2 - x1) / (y2 - y1);
+        int64_t x_short = FP_FROM_INT(x1) + step * (y - y1);
+        for (; y <= y_last; y++) {
+            lcd_fill_span(lcd, (int32_t)FP_ROUND(x_short), (int32_t)FP_ROUND(x_long), y, color);
+            x_short += step;
+            x_long += step_long;
+        }
+    }
+}
+
+// Polygon edge for the active-edge table
+typedef struct {
+    int64_t x;          // 16.16 X at the current scanline
+    int64_t dxdy;       // 16.16 X step per scanline
+    int32_t y_top;      // First scanline covered
+    int32_t y_bottom;   // Last scanline covered (inclusive)
+} poly_edge_t;
+
+// A bottom vertex is a local maximum if the outline turns back up after it
+// (skipping horizontal edges). Those rows keep both edges so the vertex is filled;
+// pass-through vertices keep only the lower edge so parity stays even.
+static bool poly_is_local_max(const ili9225_point_t* pts, size_t n, size_t k, int dir) {
+    size_t j = k;
+    for (size_t guard = 0; guard < n; guard++) {
+        size_t next = (j + n + dir) % n;
+        if (pts[next].y != pts[k].y) {
+            return pts[next].y < pts[k].y;
+        }
+        j = next;
+    }
+    return true;
+}
+
+void ili9225_fill_polygon(ili9225_t* lcd, const ili9225_point_t* points, size_t count, uint16_t color) {
+    if (!lcd || !points || count < 3) return;
+    if (count > ILI9225_POLYGON_MAX_VERTICES) {
+        LOG_WARN("fill_polygon: %u vertices, max %u", (unsigned)count, ILI9225_POLYGON_MAX_VERTICES);
+        return;
+    }
+
+    // Build the edge table (in screen coordinates) sorted by top scanline;
+    // horizontal edges are implied by their neighbours
+    poly_edge_t edges[ILI9225_POLYGON_MAX_VERTICES];
+    size_t n_edges = 0;
+    int32_t y_min = points[0].y, y_max = points[0].y;
+    int32_t x_min = points[0].x, x_max = points[0].x;
+
+    for (size_t i = 0; i < count; i++) {
+        size_t j = (i + 1) % count;
+        const ili9225_point_t* a = &points[i];
+        const ili9225_point_t* b = &points[j];
+        if (a->y < y_min) y_min = a->y;
+        if (a->y > y_max) y_max = a->y;
+        if (a->x < x_min) x_min = a->x;
+        if (a->x > x_max) x_max = a->x;
+        if (a->y == b->y) continue;
+
+        size_t bottom = j;
+        int dir = 1;
+        if (a->y > b->y) {
+            const ili9225_point_t* t = a; a = b; b = t;
+            bottom = i;
+            dir = -1;
+        }
+
+        poly_edge_t e;
+        e.dxdy = FP_FROM_INT(b->x - a->x) / (b->y - a->y);
+        e.x = FP_FROM_INT(lcd_sx(lcd, a->x));
+        e.y_top = lcd_sy(lcd, a->y);
+        e.y_bottom = lcd_sy(lcd, poly_is_local_max(points, count, bottom, dir) ? b->y : b->y - 1);
+
+        size_t k = n_edges++;
+        while (k > 0 && edges[k - 1].y_top > e.y_top) {
+            edges[k] = edges[k - 1];
+            k--;
+        }
+        edges[k] = e;
+    }
+
+    x_min = lcd_sx(lcd, x_min);
+    x_max = lcd_sx(lcd, x_max);
+    y_min = lcd_sy(lcd, y_min);
+    y_max = lcd_sy(lcd, y_max);
+
+    if (n_edges == 0) {
+        // Degenerate: every vertex on one row
+        lcd_fill_span(lcd, x_min, x_max, y_min, color);
+        return;
+    }
+
+    // Only scanlines inside the clip are walked
+    lcd_clip_t c = lcd_clip(lcd);
+    if (x_max < c.x1 || x_min >= c.x2) return;
+    if (y_min < c.y1) y_min = c.y1;
+    if (y_max >= c.y2) y_max = c.y2 - 1;
+
+    // Active edge table, kept sorted by current X
+    poly_edge_t* active[ILI9225_POLYGON_MAX_VERTICES];
+    size_t n_active = 0;
+    size_t next_edge = 0;
+
+    // Edges starting above the clip enter the table already stepped to its top row
+    int32_t y = edges[0].y_top < y_min ? y_min : edges[0].y_top;
+    for (; y <= y_max; y++) {
+        // Drop finished edges
+        size_t kept = 0;
+        for (size_t i = 0; i < n_active; i++) {
+            if (active[i]->y_bottom >= y) active[kept++] = active[i];
+        }
+        n_active = kept;
+
+        // Add edges that start on (or, when clipped, before) this row
+        while (next_edge < n_edges && edges[next_edge].y_top <= y) {
+            poly_edge_t* e = &edges[next_edge++];
+            if (e->y_bottom < y) continue;
+            e->x += e->dxdy * (y - e->y_top);
+            active[n_active++] = e;
+        }
+
+        // Insertion sort: the order barely changes between scanlines
+        for (size_t i = 1; i < n_active; i++) {
+            poly_edge_t* e = active[i];
+            size_t k = i;
+            while (k > 0 && active[k - 1]->x > e->x) {
+                active[k] = active[k - 1];
+                k--;
+            }
+            active[k] = e;
+        }
+
+        // Even-odd rule: fill between pairs of crossings
+        for (size_t i = 0; i + 1 < n_active; i += 2) {
+            lcd_fill_span(lcd, (int32_t)FP_ROUND(active[i]->x), (int32_t)FP_ROUND(active[i + 1]->x), y, color);
+        }
+
+        for (size_t i = 0; i < n_active; i++) {
+            active[i]->x += active[i]->dxdy;
+        }
+    }
 }
 
 // ============================================================================
 // Text & Bitmap Functions
 // ============================================================================
 
-void ili9225_draw_char(ili9225_t* lcd, uint16_t x, uint16_t y, char c, const font_t *font, uint16_t color) {
-    if (!font) return;
-    
-    // Basic bounds check
-    if (c < 32 || c > 126) return; 
+// Row bytes of a fixed-width font character, or NULL outside the font
+static inline const uint8_t* lcd_font_glyph(const font_t* font, char c) {
+    if ((uint8_t)c < font->first_char || (uint8_t)c > font->last_char) return NULL;
+    return &font->data[((uint8_t)c - font->first_char) * font->height];
+}
 
-    // Assuming standard monospace font where width is padded to byte
-    // Adjust logic if your font struct differs.
-    
-    // Example logic for 5x7 or 8x8 bitmap font
-    // uint8_t *char_data = &font->data[(c - 32) * font->width];
-    
-    // Since "font_t" structure isn't strictly defined in your snippet, 
-    // I will assume a standard GFX-style drawing or leave this as a stub
-    // requiring the specific font implementation details.
-    
-    // Placeholder for generic character drawing
+// Column bits a font row may use
+static inline uint8_t lcd_font_mask(const font_t* font) {
+    return (font->width >= 8) ? 0xFF : (uint8_t)((1u << font->width) - 1);
 }
 
-void ili9225_draw_gfx_char(ili9225_t* lcd, uint16_t x, uint16_t y,
+// Draw the lit pixels of a character at screen position (sx, sy), each font
+// pixel a scale x scale block. Every horizontal run of lit pixels in a row
+// goes out as one burst.
+static void lcd_font_char(ili9225_t* lcd, int32_t sx, int32_t sy, const uint8_t* glyph,
+                          const font_t* font, uint8_t scale, uint16_t color) {
+    lcd_clip_t clip = lcd_clip(lcd);
+    int32_t x1 = sx, y1 = sy, x2 = sx + font->width * scale, y2 = sy + font->height * scale;
+    if (!lcd_clip_box(&clip, &x1, &y1, &x2, &y2)) return;
+
+    uint8_t mask = lcd_font_mask(font);
+    for (uint8_t row = 0; row < font->height; row++) {
+        uint8_t bits = glyph[row] & mask;
+        int32_t col = 0;
+        while (bits) {
+            while (!(bits & 1)) {
+                bits >>= 1;
+                col++;
+            }
+            int32_t start = col;
+            while (bits & 1) {
+                bits >>= 1;
+                col++;
+            }
+            lcd_fill_rect(lcd, sx + start * scale, sy + row * scale,
+                          (col - start) * scale, scale, color, true);
+        }
+    }
+}
+
+void ili9225_draw_char(ili9225_t* lcd, int16_t x, int16_t y, char c, const font_t *font, uint16_t color) {
+    if (!lcd || !font) return;
+    const uint8_t* glyph = lcd_font_glyph(font, c);
+    if (!glyph) return;
+    lcd_font_char(lcd, lcd_sx(lcd, x), lcd_sy(lcd, y), glyph, font, 1, color);
+}
+
+void ili9225_draw_gfx_char(ili9225_t* lcd, int16_t x, int16_t y,
                            char c, const GFXfont *font, uint16_t color) {
     if (!font) return;
+    if ((uint8_t)c < font->first || (uint8_t)c > font->last) return;
 
-    c -= (uint8_t)font->first;
-    GFXglyph *glyph = &font->glyph[c];
-    uint8_t *bitmap = font->bitmap;
+    const GFXglyph *glyph = &font->glyph[(uint8_t)c - font->first];
+    const uint8_t *bitmap = font->bitmap;
 
     uint16_t bo = glyph->bitmapOffset;
     uint8_t  w  = glyph->width;
     uint8_t  h  = glyph->height;
-    int8_t   xo = glyph->xOffset;
-    int8_t   yo = glyph->yOffset;
-    
-    uint8_t  xx, yy, bits = 0, bit = 0;
+    int32_t  gx = lcd_sx(lcd, x) + glyph->xOffset;
+    int32_t  gy = lcd_sy(lcd, y) + glyph->yOffset;
+
+    // Only walk the glyph rows and columns inside the clip
+    lcd_clip_t clip = lcd_clip(lcd);
+    int32_t x1 = gx, y1 = gy, x2 = gx + w, y2 = gy + h;
+    if (!lcd_clip_box(&clip, &x1, &y1, &x2, &y2)) return;
+
+    for (int32_t yy = y1 - gy; yy < y2 - gy; yy++) {
+        // Glyph bitmaps are bit-packed without row padding
+        uint32_t bit = (uint32_t)yy * w + (x1 - gx);
+        int32_t run_start = -1;
+        for (int32_t xx = x1 - gx; xx <= x2 - gx; xx++, bit++) {
+            bool lit = xx < x2 - gx && (bitmap[bo + (bit >> 3)] & (0x80 >> (bit & 7)));
+            if (lit && run_start < 0) {
+                run_start = xx;
+            } else if (!lit && run_start >= 0) {
+                // Each run of lit pixels on a row goes out as one burst
+                lcd_fill_rect(lcd, gx + run_start, gy + yy, xx - run_start, 1, color, true);
+                run_start = -1;
+            }
+        }
+    }
+}
 
-    for (yy = 0; yy < h; yy++) {
-        for (xx = 0; xx < w; xx++) {
-            if (!(bit++ & 7)) {
-                bits = bitmap[bo++];
+static inline const GFXglyph* lcd_gfx_glyph(const GFXfont* font, char c) {
+    if ((uint8_t)c < font->first || (uint8_t)c > font->last) return NULL;
+    return &font->glyph[(uint8_t)c - font->first];
+}
+
+// One line of opaque GFX text, in drawing coordinates
+typedef struct {
+    const char* text;
+    size_t len;
+    const GFXfont* font;
+    int32_t x;          // Cursor at the first character
+    int32_t baseline;
+    uint16_t fg, bg;
+} lcd_text_line_t;
+
+// Scanline callback: background, with the glyph bits crossing row y set to fg
+static void lcd_text_scanline(uint16_t* line, int16_t x, int16_t y, uint16_t w, void* user) {
+    const lcd_text_line_t* t = user;
+    for (uint16_t i = 0; i < w; i++) {
+        line[i] = t->bg;
+    }
+
+    int32_t cursor = t->x;
+    for (size_t i = 0; i < t->len; i++) {
+        const GFXglyph* g = lcd_gfx_glyph(t->font, t->text[i]);
+        if (!g) continue;
+        int32_t gx = cursor + g->xOffset, gy = t->baseline + g->yOffset;
+        cursor += g->xAdvance;
+        if (y < gy || y >= gy + g->height) continue;
+
+        // Glyph columns inside [x, x + w)
+        int32_t c1 = (x > gx) ? x - gx : 0;
+        int32_t c2 = (x + w < gx + g->width) ? x + w - gx : g->width;
+        const uint8_t* bitmap = t->font->bitmap + g->bitmapOffset;
+        uint32_t bit = (uint32_t)(y - gy) * g->width + c1;
+        for (int32_t col = c1; col < c2; col++, bit++) {
+            if (bitmap[bit >> 3] & (0x80 >> (bit & 7))) {
+                line[gx + col - x] = t->fg;
             }
-            if (bits & 0x80) {
-                ili9225_draw_pixel(lcd, x + xo + xx, y + yo + yy, color);
+        }
+    }
+}
+
+void ili9225_gfx_font_extent(const GFXfont* font, int32_t* top, int32_t* bottom) {
+    *top = 0;
+    *bottom = 0;
+    for (uint16_t i = 0; i <= font->last - font->first; i++) {
+        const GFXglyph* g = &font->glyph[i];
+        if (g->yOffset < *top) *top = g->yOffset;
+        if (g->yOffset + g->height > *bottom) *bottom = g->yOffset + g->height;
+    }
+}
+
+// Render a line of opaque text as one window: its advance across (plus any
+// overhanging ink), the font's tallest glyph extents down
+static void lcd_text_line(ili9225_t* lcd, const lcd_text_line_t* t) {
+    const GFXfont* font = t->font;
+    int32_t top, bottom;
+    ili9225_gfx_font_extent(font, &top, &bottom);
+
+    int32_t x1 = t->x, x2 = t->x, cursor = t->x;
+    for (size_t i = 0; i < t->len; i++) {
+        const GFXglyph* g = lcd_gfx_glyph(font, t->text[i]);
+        if (!g) continue;
+        if (g->width > 0 && g->height > 0) {
+            if (cursor + g->xOffset < x1) x1 = cursor + g->xOffset;
+            if (cursor + g->xOffset + g->width > x2) x2 = cursor + g->xOffset + g->width;
+        }
+        cursor += g->xAdvance;
+    }
+    if (cursor > x2) x2 = cursor;
+    if (x2 <= x1 || bottom <= top) return;
+
+    ili9225_render_scanlines_region(lcd, (int16_t)x1, (int16_t)(t->baseline + top),
+                                    (uint16_t)(x2 - x1), (uint16_t)(bottom - top),
+                                    lcd_text_scanline, (void*)t);
+}
+
+// Render a line of opaque text from the attached glyph cache, one cell per
+// character. Cells outside the clip are skipped before the lookup so they do
+// not push visible glyphs out of the cache.
+//
+// Where ink reaches past a glyph's advance the neighbouring cells overlap,
+// and neither cached cell holds the other glyph's pixels there. Characters
+// with overlapping cells are drawn together from the font bitmaps instead.
+static void lcd_text_line_cached(ili9225_t* lcd, const lcd_text_line_t* t) {
+    lcd_clip_t c = lcd_clip(lcd);
+    int32_t top, bottom;
+    ili9225_gfx_font_extent(t->font, &top, &bottom);
+    int32_t sy = lcd_sy(lcd, t->baseline);
+    if (sy + bottom <= c.y1 || sy + top >= c.y2) return;
+
+    int32_t cursor = t->x;
+    for (size_t i = 0; i < t->len; ) {
+        const GFXglyph* g = lcd_gfx_glyph(t->font, t->text[i]);
+        if (!g) {
+            i++;
+            continue;
+        }
+
+        // Span [x1, x2) of this cell and any later ones overlapping it
+        int32_t x1 = cursor + ((g->xOffset < 0) ? g->xOffset : 0);
+        int32_t x2 = cursor + ((g->xOffset + g->width > g->xAdvance) ? g->xOffset + g->width : g->xAdvance);
+        int32_t next = cursor + g->xAdvance;
+        size_t n = 1;
+        for (; i + n < t->len; n++) {
+            const GFXglyph* h = lcd_gfx_glyph(t->font, t->text[i + n]);
+            if (!h) continue;
+            int32_t left = (h->xOffset < 0) ? h->xOffset : 0;
+            int32_t right = (h->xOffset + h->width > h->xAdvance) ? h->xOffset + h->width : h->xAdvance;
+            if (next + left >= x2) break;
+            if (next + left < x1) x1 = next + left;
+            if (next + right > x2) x2 = next + right;
+            next += h->xAdvance;
+        }
+
+        if (lcd_sx(lcd, x2) > c.x1 && lcd_sx(lcd, x1) < c.x2) {
+            ili9225_glyph_box_t box;
+            const uint16_t* cell = (n == 1) ? ili9225_glyph_cache_get(lcd->glyph_cache, t->font, t->text[i],
+                                                                     t->fg, t->bg, &box) : NULL;
+            if (cell) {
+                ili9225_draw_rgb565(lcd, (int16_t)(cursor + box.dx), (int16_t)(t->baseline + box.dy),
+                                    box.w, box.h, cell);
+            } else {
+                // Overlapping cells, or a cell too large for the cache
+                lcd_text_line_t run = { &t->text[i], n, t->font, cursor, t->baseline, t->fg, t->bg };
+                lcd_text_line(lcd, &run);
             }
-            bits <<= 1;
         }
+        cursor = next;
+        i += n;
     }
 }
 
-void ili9225_draw_gfx_text(ili9225_t* lcd, uint16_t x, uint16_t y,
+void ili9225_gfx_text_run(ili9225_t* lcd, int32_t x, int32_t y, const char* text, size_t len,
+                          const GFXfont* font, uint16_t fg, uint16_t bg, bool opaque) {
+    if (opaque) {
+        lcd_text_line_t t = { text, len, font, x, y, fg, bg };
+        if (lcd->glyph_cache) {
+            lcd_text_line_cached(lcd, &t);
+        } else {
+            lcd_text_line(lcd, &t);
+        }
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        const GFXglyph* g = lcd_gfx_glyph(font, text[i]);
+        if (!g) continue;
+        ili9225_draw_gfx_char(lcd, (int16_t)x, (int16_t)y, text[i], font, fg);
+        x += g->xAdvance;
+    }
+}
+
+void ili9225_draw_gfx_char_opaque(ili9225_t* lcd, int16_t x, int16_t y,
+                                  char c, const GFXfont *font, uint16_t fg, uint16_t bg) {
+    if (!lcd || !font) return;
+    ili9225_gfx_text_run(lcd, x, y, &c, 1, font, fg, bg, true);
+}
+
+void ili9225_draw_gfx_text_opaque(ili9225_t* lcd, int16_t x, int16_t y,
+                                  const char* text, const GFXfont *font, uint16_t fg, uint16_t bg) {
+    if (!lcd || !text || !font) return;
+
+    int32_t baseline = y;
+    for (;;) {
+        size_t len = strcspn(text, "\n");
+        ili9225_gfx_text_run(lcd, x, baseline, text, len, font, fg, bg, true);
+        if (text[len] == '\0') break;
+        text += len + 1;
+        baseline += font->yAdvance;
+    }
+}
+
+void ili9225_draw_gfx_text(ili9225_t* lcd, int16_t x, int16_t y,
                            const char* text, const GFXfont *font, uint16_t color) {
     if (!text || !font) return;
     
-    uint16_t cursor_x = x;
-    uint16_t cursor_y = y;
+    int16_t cursor_x = x;
+    int16_t cursor_y = y;
 
     while (*text) {
         char c = *text++;
@@ -510,34 +1485,229 @@ void ili9225_draw_gfx_text(ili9225_t* lcd, uint16_t x, uint16_t y,
             cursor_y += font->yAdvance;
         } else if (c != '\r') {
             ili9225_draw_gfx_char(lcd, cursor_x, cursor_y, c, font, color);
-            cursor_x += font->glyph[c - font->first].xAdvance;
+            if ((uint8_t)c >= font->first && (uint8_t)c <= font->last) {
+                cursor_x += font->glyph[(uint8_t)c - font->first].xAdvance;
+            }
+        }
+    }
+}
+
+// One line of opaque fixed-width text, in drawing coordinates
+typedef struct {
+    const char* text;
+    size_t len;
+    const font_t* font;
+    int32_t x, y;       // Top-left corner of the first cell
+    uint8_t scale;
+    uint16_t fg, bg;
+} lcd_font_line_t;
+
+// Scanline callback: background, with the font pixels crossing row y set to fg
+static void lcd_font_scanline(uint16_t* line, int16_t x, int16_t y, uint16_t w, void* user) {
+    const lcd_font_line_t* t = user;
+    const font_t* font = t->font;
+    for (uint16_t i = 0; i < w; i++) {
+        line[i] = t->bg;
+    }
+
+    // The region starts at the first cell, so x >= t->x and y >= t->y
+    int32_t scale = t->scale;
+    int32_t pitch = (font->width + font->spacing) * scale;
+    uint8_t row = (uint8_t)((y - t->y) / scale);
+    uint8_t mask = lcd_font_mask(font);
+    for (size_t i = (size_t)((x - t->x) / pitch); i < t->len; i++) {
+        int32_t cx = t->x + (int32_t)i * pitch;
+        if (cx >= x + w) break;
+        const uint8_t* glyph = lcd_font_glyph(font, t->text[i]);
+        if (!glyph) continue;
+
+        uint8_t bits = glyph[row] & mask;
+        for (int32_t px = cx; bits; bits >>= 1, px += scale) {
+            if (!(bits & 1)) continue;
+            int32_t p1 = (px > x) ? px : x;
+            int32_t p2 = (px + scale < x + w) ? px + scale : x + w;
+            for (int32_t p = p1; p < p2; p++) {
+                line[p - x] = t->fg;
+            }
         }
     }
 }
 
-void ili9225_draw_text(ili9225_t* lcd, uint16_t x, uint16_t y,
+// Draw a line of fixed-width text. Opaque lines are rendered as one window
+// covering every character cell (spacing included); transparent ones as runs
+// of lit pixels. Characters outside the font leave a blank cell.
+static void lcd_font_line(ili9225_t* lcd, const lcd_font_line_t* t, bool opaque) {
+    const font_t* font = t->font;
+    int32_t pitch = (font->width + font->spacing) * t->scale;
+    if (opaque) {
+        int32_t w = (int32_t)t->len * pitch, h = font->height * t->scale;
+        if (w <= 0 || w > UINT16_MAX || h <= 0) return;
+        ili9225_render_scanlines_region(lcd, (int16_t)t->x, (int16_t)t->y, (uint16_t)w, (uint16_t)h,
+                                        lcd_font_scanline, (void*)t);
+        return;
+    }
+
+    int32_t sx = lcd_sx(lcd, t->x), sy = lcd_sy(lcd, t->y);
+    for (size_t i = 0; i < t->len; i++, sx += pitch) {
+        const uint8_t* glyph = lcd_font_glyph(font, t->text[i]);
+        if (glyph) {
+            lcd_font_char(lcd, sx, sy, glyph, font, t->scale, t->fg);
+        }
+    }
+}
+
+void ili9225_draw_text_scaled(ili9225_t* lcd, int16_t x, int16_t y, const char* text, const font_t *font,
+                              uint8_t scale, uint16_t fg, uint16_t bg, bool opaque) {
+    if (!lcd || !text || !font || scale == 0) return;
+
+    int32_t top = y;
+    for (;;) {
+        size_t len = strcspn(text, "\n");
+        lcd_font_line_t t = { text, len, font, x, top, scale, fg, bg };
+        lcd_font_line(lcd, &t, opaque);
+        if (text[len] == '\0') break;
+        text += len + 1;
+        top += font->height * scale;
+    }
+}
+
+void ili9225_draw_text(ili9225_t* lcd, int16_t x, int16_t y,
                        const char* text, const font_t *font, uint16_t color) {
-    if (!text) return;
-    uint16_t cursor_x = x;
-    while (*text) {
-        ili9225_draw_char(lcd, cursor_x, y, *text++, font, color);
-        // cursor_x += font->width; // adjust based on actual font struct
+    ili9225_draw_text_scaled(lcd, x, y, text, font, 1, color, 0, false);
+}
+
+void ili9225_draw_text_opaque(ili9225_t* lcd, int16_t x, int16_t y,
+                              const char* text, const font_t *font, uint16_t fg, uint16_t bg) {
+    ili9225_draw_text_scaled(lcd, x, y, text, font, 1, fg, bg, true);
+}
+
+void ili9225_draw_char_opaque(ili9225_t* lcd, int16_t x, int16_t y,
+                              char c, const font_t *font, uint16_t fg, uint16_t bg) {
+    if (!lcd || !font) return;
+    lcd_font_line_t t = { &c, 1, font, x, y, 1, fg, bg };
+    lcd_font_line(lcd, &t, true);
+}
+
+void ili9225_write_pixels(ili9225_t* lcd, const uint16_t* pixels, uint32_t count) {
+    if (!lcd || !pixels || count == 0) return;
+    lcd_write_gram(lcd, pixels, count, true, true);
+}
+
+void ili9225_write_pixels_async(ili9225_t* lcd, const uint16_t* pixels, uint32_t count) {
+    if (!lcd || !pixels || count == 0) return;
+    lcd_write_gram(lcd, pixels, count, true, false);
+}
+
+// Open a window on the visible part of a w x h image at drawing position (x, y).
+// Returns false if nothing is visible; otherwise *skip is the offset of the
+// first visible source pixel and *cw x *ch the visible size.
+static bool lcd_image_window(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                             uint32_t* skip, int32_t* cw, int32_t* ch) {
+    lcd_clip_t c = lcd_clip(lcd);
+    int32_t x1 = lcd_sx(lcd, x), y1 = lcd_sy(lcd, y);
+    int32_t ix = x1, iy = y1, x2 = x1 + w, y2 = y1 + h;
+    if (!lcd_clip_box(&c, &x1, &y1, &x2, &y2)) return false;
+
+    *skip = (uint32_t)(y1 - iy) * w + (x1 - ix);
+    *cw = x2 - x1;
+    *ch = y2 - y1;
+    ili9225_set_window(lcd, x1, y1, x2 - 1, y2 - 1);
+    return true;
+}
+
+void ili9225_draw_rgb565(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                         const uint16_t* pixels) {
+    if (!pixels || w == 0 || h == 0) return;
+
+    uint32_t skip;
+    int32_t cw, ch;
+    if (!lcd_image_window(lcd, x, y, w, h, &skip, &cw, &ch)) return;
+    pixels += skip;
+
+    if (cw == w) {
+        // Whole rows visible: contiguous in memory, one transfer
+        lcd_write_gram(lcd, pixels, (uint32_t)w * ch, true, true);
+        return;
     }
+
+    // Clipped columns: each visible row continues the same window stream
+    for (int32_t row = 0; row < ch; row++, pixels += w) {
+        lcd_write_gram(lcd, pixels, cw, true, false);
+    }
+    if (!lcd->framebuffer) ili9225_wait_idle(lcd);
 }
 
-void ili9225_draw_bitmap(ili9225_t* lcd, uint16_t x, uint16_t y,
+void ili9225_render_scanlines_region(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                                     ili9225_scanline_fn_t fill, void* user) {
+    if (!lcd || !fill || w == 0 || h == 0) return;
+
+    lcd_clip_t c = lcd_clip(lcd);
+    int32_t x1 = lcd_sx(lcd, x), y1 = lcd_sy(lcd, y);
+    int32_t x2 = x1 + w, y2 = y1 + h;
+    if (!lcd_clip_box(&c, &x1, &y1, &x2, &y2)) return;
+
+    uint16_t lines[2][(ILI9225_LCD_WIDTH > ILI9225_LCD_HEIGHT) ? ILI9225_LCD_WIDTH : ILI9225_LCD_HEIGHT];
+    ili9225_set_window(lcd, x1, y1, x2 - 1, y2 - 1);
+
+    // The callback works in drawing coordinates
+    int16_t dx = (int16_t)(x1 - lcd->origin_x);
+    int16_t dy = (int16_t)(y1 - lcd->origin_y);
+    uint16_t cw = (uint16_t)(x2 - x1);
+    for (uint16_t row = 0; row < y2 - y1; row++) {
+        // The other buffer may still be streaming; this one finished two rows ago
+        uint16_t* line = lines[row & 1];
+        fill(line, dx, dy + row, cw, user);
+        lcd_write_gram(lcd, line, cw, true, false);
+    }
+    if (!lcd->framebuffer) ili9225_wait_idle(lcd);
+}
+
+void ili9225_render_scanlines(ili9225_t* lcd, ili9225_scanline_fn_t fill, void* user) {
+    if (!lcd) return;
+    ili9225_render_scanlines_region(lcd, 0, 0, lcd->width, lcd->height, fill, user);
+}
+
+void ili9225_draw_bitmap(ili9225_t* lcd, int16_t x, int16_t y,
                          const uint8_t* bitmap, uint16_t w, uint16_t h, uint16_t color) {
-    if (!bitmap) return;
+    if (!bitmap || w == 0 || h == 0) return;
 
     // Assumes RGB565 bitmap data (16-bit color per pixel)
     // If you meant monochrome bitmap, use the bit-check logic instead.
     
-    ili9225_set_window(lcd, x, y, x + w - 1, y + h - 1);
+    uint32_t skip;
+    int32_t cw, ch;
+    if (!lcd_image_window(lcd, x, y, w, h, &skip, &cw, &ch)) return;
+    bitmap += skip * 2;
+
+    if (lcd->framebuffer) {
+        // Bitmap bytes are in wire order (high byte first)
+        uint16_t buf[32];
+        for (int32_t row = 0; row < ch; row++) {
+            const uint8_t* src = bitmap + (uint32_t)row * w * 2;
+            uint32_t remaining = cw;
+            while (remaining > 0) {
+                uint32_t n = remaining < count_of(buf) ? remaining : count_of(buf);
+                for (uint32_t i = 0; i < n; i++, src += 2) {
+                    buf[i] = (uint16_t)((src[0] << 8) | src[1]);
+                }
+                ili9225_fb_write(lcd, buf, n, true);
+                remaining -= n;
+            }
+        }
+        return;
+    }
+
     gpio_put(lcd->pin_dc, 1);
     lcd_select(lcd);
     
-    // Write the whole buffer
-    spi_write_blocking(lcd->spi, bitmap, w * h * 2);
+    // Write the visible rows
+    if (cw == w) {
+        spi_write_blocking(lcd->spi, bitmap, (size_t)w * ch * 2);
+    } else {
+        for (int32_t row = 0; row < ch; row++) {
+            spi_write_blocking(lcd->spi, bitmap + (uint32_t)row * w * 2, (size_t)cw * 2);
+        }
+    }
     
     lcd_deselect(lcd);
-}
\ No newline at end of file
+}
@@ -20,6 +20,86 @@
 #include "gfx_fonts.h"
 #include "utilities/utils.h"
 
+// Transfers shorter than this are cheaper on the CPU than setting up a DMA channel
+#ifndef ILI9225_DMA_MIN_PIXELS
+#define ILI9225_DMA_MIN_PIXELS 32
+#endif
+
+// Registers R00h..R5Fh are shadowed; higher (OTP/MTP) indices are always written
+#ifndef ILI9225_REG_SHADOW_SIZE
+#define ILI9225_REG_SHADOW_SIZE 0x60
+#endif
+
+// Largest vertex count accepted by ili9225_fill_polygon (edge tables live on the stack)
+#ifndef ILI9225_POLYGON_MAX_VERTICES
+#define ILI9225_POLYGON_MAX_VERTICES 32
+#endif
+
+// Points ili9225_draw_pixels sorts at a time (the sort keys live on the stack, 4 bytes each)
+#ifndef ILI9225_PIXELS_CHUNK
+#define ILI9225_PIXELS_CHUNK 128
+#endif
+
+// Nested clip rectangles ili9225_push_clip can save
+#ifndef ILI9225_CLIP_STACK_DEPTH
+#define ILI9225_CLIP_STACK_DEPTH 4
+#endif
+
+// Dirty regions tracked in framebuffer mode before they are merged together
+#ifndef ILI9225_MAX_DIRTY_RECTS
+#define ILI9225_MAX_DIRTY_RECTS 4
+#endif
+
+// Extra pixels worth sending to save a window setup when merging dirty regions
+#ifndef ILI9225_DIRTY_MERGE_SLACK
+#define ILI9225_DIRTY_MERGE_SLACK 64
+#endif
+
+// Skip framebuffer tiles whose contents match what was last sent (0 = always send dirty areas)
+#ifndef ILI9225_TILE_DIFF
+#define ILI9225_TILE_DIFF 1
+#endif
+
+// Edge length of a flush-diff tile in pixels
+#ifndef ILI9225_TILE_SIZE
+#define ILI9225_TILE_SIZE 16
+#endif
+
+// Tiles covering the screen in either orientation
+#define ILI9225_TILE_COLS(w) (((w) + ILI9225_TILE_SIZE - 1) / ILI9225_TILE_SIZE)
+#define ILI9225_TILE_COUNT (ILI9225_TILE_COLS(ILI9225_LCD_WIDTH) * ILI9225_TILE_COLS(ILI9225_LCD_HEIGHT))
+
+// Pixels in a full-screen RGB565 framebuffer (~77 KB)
+#define ILI9225_FRAMEBUFFER_PIXELS (ILI9225_LCD_WIDTH * ILI9225_LCD_HEIGHT)
+
+// Bytes in a full-screen indexed framebuffer of `bpp` bits per pixel (rows are byte aligned)
+#define ILI9225_INDEXED_ROW_BYTES(w, bpp) (((w) * (bpp) + 7) / 8)
+#define ILI9225_INDEXED_FRAMEBUFFER_BYTES(bpp) \
+    ((ILI9225_INDEXED_ROW_BYTES(ILI9225_LCD_WIDTH, bpp) * ILI9225_LCD_HEIGHT > \
+      ILI9225_INDEXED_ROW_BYTES(ILI9225_LCD_HEIGHT, bpp) * ILI9225_LCD_WIDTH) ? \
+     ILI9225_INDEXED_ROW_BYTES(ILI9225_LCD_WIDTH, bpp) * ILI9225_LCD_HEIGHT : \
+     ILI9225_INDEXED_ROW_BYTES(ILI9225_LCD_HEIGHT, bpp) * ILI9225_LCD_WIDTH)
+
+// Register index/value pair for batched register writes
+typedef struct {
+    uint8_t reg;        // Register index (see ili9225_defs.h)
+    uint16_t value;     // 16-bit register value
+} ili9225_reg_t;
+
+// Screen point, e.g. a polygon vertex
+typedef struct {
+    int16_t x;
+    int16_t y;
+} ili9225_point_t;
+
+// Screen rectangle
+typedef struct {
+    int16_t x;
+    int16_t y;
+    uint16_t w;
+    uint16_t h;
+} ili9225_rect_t;
+
 // Structure to hold ILI9225 configuration
 typedef struct {
     // --- Hardware Interface ---
@@ -35,8 +115,51 @@ typedef struct {
     uint16_t height;    // Current height (changes with rotation)
     ili9225_rotation_t rotation; // Current rotation
     bool is_rgb_order;  // True = RGB, False = BGR
+
+    // --- DMA ---
+    int dma_chan;       // Claimed DMA channel (-1 = none, CPU transfers only)
+    uint16_t dma_color; // Source word for solid fills, read by DMA while a fill runs
+    bool dma_busy;      // True while an async transfer owns the SPI bus
+    uint8_t spi_bits;   // Current SPI frame size: 8 for commands, 16 for pixel streams
+
+    // --- Register Shadow ---
+    uint16_t reg_shadow[ILI9225_REG_SHADOW_SIZE];  // Last value written to each register
+    uint32_t reg_shadow_valid[(ILI9225_REG_SHADOW_SIZE + 31) / 32]; // Bit set = shadow entry is current
+    uint32_t reg_writes_issued; // Register writes sent to the panel
+    uint32_t reg_writes_elided; // Register writes skipped because the value was unchanged
+
+    // --- Clipping & Translation ---
+    ili9225_rect_t clip;    // Drawing is limited to this screen area
+    ili9225_rect_t clip_stack[ILI9225_CLIP_STACK_DEPTH]; // Clips saved by ili9225_push_clip
+    uint8_t clip_depth;
+    int16_t origin_x;       // Screen position of drawing coordinate (0, 0)
+    int16_t origin_y;
+
+    // --- Framebuffer ---
+    void* framebuffer;      // RAM render target, fb_rows rows of fb_stride bytes (NULL = draw to the panel)
+    uint8_t fb_bpp;         // Framebuffer format: 16 = RGB565, 8/4/2/1 = palette indices
+    uint16_t fb_stride;     // Bytes per framebuffer row
+    const uint16_t* palette; // RGB565 colour of each index in indexed formats
+    uint16_t fb_y0;         // Screen row stored in the first framebuffer row (non-zero for bands)
+    uint16_t fb_rows;       // Rows held by the framebuffer
+    uint16_t fb_win_x1, fb_win_y1, fb_win_x2, fb_win_y2; // Framebuffer write window
+    uint16_t fb_cur_x, fb_cur_y; // Framebuffer write cursor inside the window
+    ili9225_rect_t dirty[ILI9225_MAX_DIRTY_RECTS]; // Areas not yet flushed to the panel
+    uint8_t dirty_count;
+#if ILI9225_TILE_DIFF
+    uint32_t tile_hash[ILI9225_TILE_COUNT]; // Hash of each tile as last sent (0 = unknown)
+    uint32_t tiles_sent;    // Dirty tiles sent because their contents changed
+    uint32_t tiles_skipped; // Dirty tiles skipped because the panel already shows them
+#endif
+
+    // --- Text ---
+    struct ili9225_glyph_cache* glyph_cache; // Expanded glyph cells for opaque text (NULL = none)
 } ili9225_t;
 
+// Scanline callback: fill line[0..w-1] with the RGB565 pixels of row y, starting at column x
+// (drawing coordinates, i.e. before the origin offset)
+typedef void (*ili9225_scanline_fn_t)(uint16_t* line, int16_t x, int16_t y, uint16_t w, void* user);
+
 
 // Public API
 
@@ -57,6 +180,71 @@ void ili9225_init(ili9225_t* config);
  */
 void ili9225_set_orientation(ili9225_t* config, ili9225_rotation_t rotation);
 
+/**
+ * @brief Write a batch of registers in a single SPI transaction
+ * 
+ * CS stays asserted for the whole batch; only DC toggles between the
+ * index byte and the data bytes of each entry. Entries whose value matches
+ * the register shadow are skipped.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param regs Array of register/value pairs, written in order
+ * @param count Number of entries in regs
+ * @return void
+ */
+void ili9225_write_registers(ili9225_t* config, const ili9225_reg_t* regs, size_t count);
+
+/**
+ * @brief Forget the register shadow so the next write of every register goes out
+ * 
+ * Use after talking to the panel behind the driver's back (e.g. a hardware reset).
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @return void
+ */
+void ili9225_invalidate_registers(ili9225_t* config);
+
+/**
+ * @brief Set the GRAM window and open it for pixel data
+ * 
+ * Subsequent ili9225_write_pixels calls fill the window left to right,
+ * top to bottom.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x1 Left column (inclusive)
+ * @param y1 Top row (inclusive)
+ * @param x2 Right column (inclusive)
+ * @param y2 Bottom row (inclusive)
+ * @return void
+ */
+void ili9225_set_window(ili9225_t* config, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+/**
+ * @brief Stream native RGB565 pixels into the current GRAM window
+ * 
+ * The SPI is switched to 16-bit frames so the buffer goes straight to the
+ * FIFO; the next command switches it back to 8-bit automatically.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param pixels Pixel buffer (native uint16_t RGB565)
+ * @param count Number of pixels to send
+ * @return void
+ */
+void ili9225_write_pixels(ili9225_t* config, const uint16_t* pixels, uint32_t count);
+
+/**
+ * @brief Start streaming pixels into the current GRAM window without waiting
+ * 
+ * The buffer must stay valid until ili9225_wait_idle returns. Another
+ * write_pixels call continues the same GRAM stream.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param pixels Pixel buffer (native uint16_t RGB565)
+ * @param count Number of pixels to send
+ * @return void
+ */
+void ili9225_write_pixels_async(ili9225_t* config, const uint16_t* pixels, uint32_t count);
+
 /**
  * @brief Fill the entire screen with a specific color
  * 
@@ -66,6 +254,18 @@ void ili9225_set_orientation(ili9225_t* config, ili9225_rotation_t rotation);
  */
 void ili9225_fill_screen(ili9225_t* config, uint16_t color);
 
+/**
+ * @brief Start filling the entire screen without waiting for completion
+ * 
+ * The transfer runs on DMA; the next driver call (or ili9225_wait_idle)
+ * waits for it to finish before touching the bus again.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param color 16-bit color value to fill the screen with
+ * @return void
+ */
+void ili9225_fill_screen_async(ili9225_t* config, uint16_t color);
+
 /**
  * @brief Draw a pixel at specified coordinates with a specific color
  * 
@@ -75,11 +275,62 @@ void ili9225_fill_screen(ili9225_t* config, uint16_t color);
  * @param color 16-bit color value of the pixel
  * @return void
  */
-void ili9225_draw_pixel(ili9225_t* config, uint16_t x, uint16_t y, uint16_t color);
+void ili9225_draw_pixel(ili9225_t* config, int16_t x, int16_t y, uint16_t color);
+
+// ili9225_draw_pixels flags
+#define ILI9225_PIXELS_HOLD_CS (1u << 0) // Keep CS asserted for the whole batch
+
+/**
+ * @brief Draw a set of individually coloured pixels
+ * 
+ * Points are sorted by row and column, and horizontally adjacent points go
+ * out as one auto-incrementing run, so a scatter plot costs one address
+ * setup per run instead of one per pixel. Sorting works on chunks of
+ * ILI9225_PIXELS_CHUNK points; where points repeat, the later one wins.
+ * With ILI9225_PIXELS_HOLD_CS the panel keeps the bus for the whole batch,
+ * saving the CS toggles but blocking other devices on the same SPI bus.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param points Pixel coordinates
+ * @param colors 16-bit color value of each point
+ * @param count Number of points
+ * @param flags ILI9225_PIXELS_* flags, or 0
+ * @return void
+ */
+void ili9225_draw_pixels(ili9225_t* config, const ili9225_point_t* points, const uint16_t* colors,
+                         size_t count, uint8_t flags);
+
+/**
+ * @brief Draw a horizontal line as a single window burst
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the left end
+ * @param y Y coordinate of the line
+ * @param w Length in pixels
+ * @param color 16-bit color value of the line
+ * @return void
+ */
+void ili9225_draw_hline(ili9225_t* config, int16_t x, int16_t y, uint16_t w, uint16_t color);
+
+/**
+ * @brief Draw a vertical line as a single window burst
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the line
+ * @param y Y coordinate of the top end
+ * @param h Length in pixels
+ * @param color 16-bit color value of the line
+ * @return void
+ */
+void ili9225_draw_vline(ili9225_t* config, int16_t x, int16_t y, uint16_t h, uint16_t color);
 
 /**
  * @brief Draw a line from (x0, y0) to (x1, y1) with a specific color
  * 
+ * Pixels are grouped into horizontal/vertical runs, each sent as one burst.
+ * Endpoints may lie anywhere in the int16_t range: only the steps that land
+ * inside the clip are walked, and they plot the same pixels as the whole line.
+ * 
  * @param config Pointer to ili9225_t structure
  * @param x0 Starting X coordinate
  * @param y0 Starting Y coordinate
@@ -88,7 +339,7 @@ void ili9225_draw_pixel(ili9225_t* config, uint16_t x, uint16_t y, uint16_t colo
  * @param color 16-bit color value of the line
  * @return void
  */
-void ili9225_draw_line(ili9225_t* config, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+void ili9225_draw_line(ili9225_t* config, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
 
 /**
  * @brief Draw a rectangle at specified coordinates with width, height, and color
@@ -101,7 +352,7 @@ void ili9225_draw_line(ili9225_t* config, uint16_t x0, uint16_t y0, uint16_t x1,
  * @param color 16-bit color value of the rectangle
  * @return void
  */
-void ili9225_draw_rect(ili9225_t* config, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void ili9225_draw_rect(ili9225_t* config, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
 
 /**
  * @brief Fill a rectangle at specified coordinates with width, height, and color
@@ -114,7 +365,41 @@ void ili9225_draw_rect(ili9225_t* config, uint16_t x, uint16_t y, uint16_t w, ui
  * @param color 16-bit color value to fill the rectangle with
  * @return void
  */
-void ili9225_fill_rect(ili9225_t* config, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void ili9225_fill_rect(ili9225_t* config, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief Start filling a rectangle without waiting for completion
+ * 
+ * Falls back to a blocking CPU transfer when no DMA channel is available
+ * or the area is smaller than ILI9225_DMA_MIN_PIXELS.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the top-left corner
+ * @param y Y coordinate of the top-left corner
+ * @param w Width of the rectangle
+ * @param h Height of the rectangle
+ * @param color 16-bit color value to fill the rectangle with
+ * @return void
+ */
+void ili9225_fill_rect_async(ili9225_t* config, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief Check whether an async transfer is still running
+ * 
+ * Releases the bus (CS high) once the transfer has completed.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @return true while a transfer is in flight
+ */
+bool ili9225_is_busy(ili9225_t* config);
+
+/**
+ * @brief Block until any async transfer has completed
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @return void
+ */
+void ili9225_wait_idle(ili9225_t* config);
 
 /**
  * @brief Draw a circle at specified coordinates with radius and color
@@ -126,11 +411,13 @@ void ili9225_fill_rect(ili9225_t* config, uint16_t x, uint16_t y, uint16_t w, ui
  * @param color 16-bit color value of the circle
  * @return void
  */
-void ili9225_draw_circle(ili9225_t* config, uint16_t x, uint16_t y, uint16_t r, uint16_t color);
+void ili9225_draw_circle(ili9225_t* config, int16_t x, int16_t y, uint16_t r, uint16_t color);
 
 /**
  * @brief Fill a circle at specified coordinates with radius and color
  * 
+ * Every row is computed once and sent as a single span burst.
+ * 
  * @param config Pointer to ili9225_t structure
  * @param x X coordinate of the center
  * @param y Y coordinate of the center
@@ -138,7 +425,35 @@ void ili9225_draw_circle(ili9225_t* config, uint16_t x, uint16_t y, uint16_t r,
  * @param color 16-bit color value to fill the circle with
  * @return void
  */
-void ili9225_fill_circle(ili9225_t* config, uint16_t x, uint16_t y, uint16_t r, uint16_t color);
+void ili9225_fill_circle(ili9225_t* config, int16_t x, int16_t y, uint16_t r, uint16_t color);
+
+/**
+ * @brief Fill an axis-aligned ellipse
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the center
+ * @param y Y coordinate of the center
+ * @param rx Horizontal radius
+ * @param ry Vertical radius
+ * @param color 16-bit color value to fill the ellipse with
+ * @return void
+ */
+void ili9225_fill_ellipse(ili9225_t* config, int16_t x, int16_t y, uint16_t rx, uint16_t ry, uint16_t color);
+
+/**
+ * @brief Fill a ring (annulus) between two radii
+ * 
+ * The hole is exactly the area ili9225_fill_circle(r_inner) would cover.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the center
+ * @param y Y coordinate of the center
+ * @param r_outer Outer radius
+ * @param r_inner Inner radius (must be smaller than r_outer)
+ * @param color 16-bit color value to fill the ring with
+ * @return void
+ */
+void ili9225_fill_ring(ili9225_t* config, int16_t x, int16_t y, uint16_t r_outer, uint16_t r_inner, uint16_t color);
 
 /**
  * @brief Draw a triangle given three vertices and a color
@@ -153,14 +468,16 @@ void ili9225_fill_circle(ili9225_t* config, uint16_t x, uint16_t y, uint16_t r,
  * @param color 16-bit color value of the triangle
  * @return void
  */
-void ili9225_draw_triangle(ili9225_t* config, uint16_t x0, uint16_t y0,
-                   uint16_t x1, uint16_t y1,
-                   uint16_t x2, uint16_t y2,
+void ili9225_draw_triangle(ili9225_t* config, int16_t x0, int16_t y0,
+                   int16_t x1, int16_t y1,
+                   int16_t x2, int16_t y2,
                    uint16_t color);
 
 /**
  * @brief Fill a triangle given three vertices and a color
  * 
+ * Scanline filler: one horizontal span (one window burst) per row.
+ * 
  * @param config Pointer to ili9225_t structure
  * @param x0 X coordinate of the first vertex
  * @param y0 Y coordinate of the first vertex
@@ -171,11 +488,25 @@ void ili9225_draw_triangle(ili9225_t* config, uint16_t x0, uint16_t y0,
  * @param color 16-bit color value to fill the triangle with
  * @return void
  */
-void ili9225_fill_triangle(ili9225_t* config, uint16_t x0, uint16_t y0,
-                   uint16_t x1, uint16_t y1,
-                   uint16_t x2, uint16_t y2,
+void ili9225_fill_triangle(ili9225_t* config, int16_t x0, int16_t y0,
+                   int16_t x1, int16_t y1,
+                   int16_t x2, int16_t y2,
                    uint16_t color);
 
+/**
+ * @brief Fill a polygon (convex or concave) given its vertices
+ * 
+ * Uses an active-edge table and the even-odd rule, emitting one span per
+ * crossing pair on each row. Vertices may lie off screen.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param points Array of vertices in drawing order (closed implicitly)
+ * @param count Number of vertices (3..ILI9225_POLYGON_MAX_VERTICES)
+ * @param color 16-bit color value to fill the polygon with
+ * @return void
+ */
+void ili9225_fill_polygon(ili9225_t* config, const ili9225_point_t* points, size_t count, uint16_t color);
+
 /**
  * @brief Draw GFX text at specified coordinates with color
  * 
@@ -187,11 +518,14 @@ void ili9225_fill_triangle(ili9225_t* config, uint16_t x0, uint16_t y0,
  * @param color 16-bit color value of the text
  * @return void
  */
-void ili9225_draw_gfx_text(ili9225_t* config, uint16_t x, uint16_t y,
+void ili9225_draw_gfx_text(ili9225_t* config, int16_t x, int16_t y,
                const char* text, const GFXfont *font, uint16_t color);
 
 /**
- * @brief Draw text at specified coordinates with color and size
+ * @brief Draw text at specified coordinates with color
+ * 
+ * Characters are font->width + font->spacing pixels apart; '\n' starts a new
+ * line font->height pixels further down. Only the lit pixels are drawn.
  * 
  * @param config Pointer to ili9225_t structure
  * @param x X coordinate of the top-left corner of the text
@@ -201,9 +535,49 @@ void ili9225_draw_gfx_text(ili9225_t* config, uint16_t x, uint16_t y,
  * @param color 16-bit color value of the text
  * @return void
  */
-void ili9225_draw_text(ili9225_t* config, uint16_t x, uint16_t y,
+void ili9225_draw_text(ili9225_t* config, int16_t x, int16_t y,
                const char* text, const font_t *font, uint16_t color);
 
+/**
+ * @brief Draw text over a solid background
+ * 
+ * Each line is rendered one scanline at a time and sent through a single
+ * window covering all its character cells, spacing included, so redrawing a
+ * value of the same length replaces the old one without clearing it first.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the top-left corner of the text
+ * @param y Y coordinate of the top-left corner of the text
+ * @param text Null-terminated string to draw
+ * @param font Pointer to font_t structure defining the font
+ * @param fg 16-bit color value of the text
+ * @param bg 16-bit color value of the background
+ * @return void
+ */
+void ili9225_draw_text_opaque(ili9225_t* config, int16_t x, int16_t y,
+                              const char* text, const font_t *font, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief Draw text with every font pixel enlarged to a scale x scale block
+ * 
+ * Lines and characters are spaced as by ili9225_draw_text, multiplied by
+ * scale. With `opaque` the cells are filled with bg as by
+ * ili9225_draw_text_opaque; otherwise bg is ignored.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the top-left corner of the text
+ * @param y Y coordinate of the top-left corner of the text
+ * @param text Null-terminated string to draw
+ * @param font Pointer to font_t structure defining the font
+ * @param scale Integer magnification (1 = native size)
+ * @param fg 16-bit color value of the text
+ * @param bg 16-bit color value of the background
+ * @param opaque Fill the character cells with bg
+ * @return void
+ */
+void ili9225_draw_text_scaled(ili9225_t* config, int16_t x, int16_t y, const char* text, const font_t *font,
+                              uint8_t scale, uint16_t fg, uint16_t bg, bool opaque);
+
 /**
  * @brief Draw a single GFX character at specified coordinates with color
  * 
@@ -215,10 +589,51 @@ void ili9225_draw_text(ili9225_t* config, uint16_t x, uint16_t y,
  * @param color 16-bit color value of the character
  * @return void
  */
-void ili9225_draw_gfx_char(ili9225_t* config, uint16_t x, uint16_t y,
+void ili9225_draw_gfx_char(ili9225_t* config, int16_t x, int16_t y,
                    char c, const GFXfont *font, uint16_t color);
+
+/**
+ * @brief Draw GFX text over a solid background
+ * 
+ * Each line of text is rendered into its box one scanline at a time and sent
+ * through a single window, instead of one burst per run of lit pixels. The
+ * box spans the line's advance (widened for overhanging ink) and the tallest
+ * glyph extents of the font, so redrawing a value in place replaces the old
+ * one without clearing it first, as long as the new text is at least as wide.
+ * With a glyph cache attached (ili9225_glyph_cache.h) each character cell is
+ * sent from the cache instead, one window per character.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the cursor at the start of each line
+ * @param y Y coordinate of the first line's baseline
+ * @param text Null-terminated string to draw
+ * @param font Pointer to GFXfont structure defining the font
+ * @param fg 16-bit color value of the text
+ * @param bg 16-bit color value of the background
+ * @return void
+ */
+void ili9225_draw_gfx_text_opaque(ili9225_t* config, int16_t x, int16_t y,
+                                  const char* text, const GFXfont *font, uint16_t fg, uint16_t bg);
+
 /**
- * @brief Draw a single character at specified coordinates with color and size
+ * @brief Draw a single GFX character over a solid background
+ * 
+ * Fills the character's advance cell as ili9225_draw_gfx_text_opaque does.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the cursor
+ * @param y Y coordinate of the baseline
+ * @param c Character to draw
+ * @param font Pointer to GFXfont structure defining the font
+ * @param fg 16-bit color value of the character
+ * @param bg 16-bit color value of the background
+ * @return void
+ */
+void ili9225_draw_gfx_char_opaque(ili9225_t* config, int16_t x, int16_t y,
+                                  char c, const GFXfont *font, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief Draw a single character at specified coordinates with color
  * 
  * @param config Pointer to ili9225_t structure
  * @param x X coordinate of the top-left corner of the character
@@ -228,9 +643,26 @@ void ili9225_draw_gfx_char(ili9225_t* config, uint16_t x, uint16_t y,
  * @param color 16-bit color value of the character
  * @return void
  */
-void ili9225_draw_char(ili9225_t* config, uint16_t x, uint16_t y,
+void ili9225_draw_char(ili9225_t* config, int16_t x, int16_t y,
                char c, const font_t *font, uint16_t color);
 
+/**
+ * @brief Draw a single character over a solid background
+ * 
+ * Fills the character cell, spacing included, in one window burst.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the top-left corner of the character
+ * @param y Y coordinate of the top-left corner of the character
+ * @param c Character to draw
+ * @param font Pointer to font_t structure defining the font
+ * @param fg 16-bit color value of the character
+ * @param bg 16-bit color value of the background
+ * @return void
+ */
+void ili9225_draw_char_opaque(ili9225_t* config, int16_t x, int16_t y,
+                              char c, const font_t *font, uint16_t fg, uint16_t bg);
+
 /**
  * @brief Draw a bitmap image at specified coordinates
  * 
@@ -243,9 +675,57 @@ void ili9225_draw_char(ili9225_t* config, uint16_t x, uint16_t y,
  * @param color 16-bit color value to use for the bitmap pixels
  * @return void
  */
-void ili9225_draw_bitmap(ili9225_t* config, uint16_t x, uint16_t y,
+void ili9225_draw_bitmap(ili9225_t* config, int16_t x, int16_t y,
                  const uint8_t* bitmap, uint16_t w, uint16_t h, uint16_t color);
 
+/**
+ * @brief Draw a native RGB565 image at specified coordinates
+ * 
+ * Unlike ili9225_draw_bitmap the buffer holds uint16_t pixels in CPU byte
+ * order and is streamed with 16-bit SPI frames.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param w Width of the image
+ * @param h Height of the image
+ * @param pixels Pointer to w * h RGB565 pixels
+ * @return void
+ */
+void ili9225_draw_rgb565(ili9225_t* config, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                         const uint16_t* pixels);
+
+/**
+ * @brief Render the whole screen from a per-scanline callback
+ * 
+ * No framebuffer is needed: the callback renders each row into one of two
+ * line buffers while the previous row is sent by DMA, all within one GRAM
+ * window (2 x 176 pixels, ~700 bytes of stack in portrait).
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param fill Called once per row, top to bottom
+ * @param user Passed through to fill
+ * @return void
+ */
+void ili9225_render_scanlines(ili9225_t* config, ili9225_scanline_fn_t fill, void* user);
+
+/**
+ * @brief Render a screen region from a per-scanline callback
+ * 
+ * Like ili9225_render_scanlines, limited to a rectangle (clipped to the screen).
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the top-left corner
+ * @param y Y coordinate of the top-left corner
+ * @param w Width of the region
+ * @param h Height of the region
+ * @param fill Called once per row with the row's screen coordinates
+ * @param user Passed through to fill
+ * @return void
+ */
+void ili9225_render_scanlines_region(ili9225_t* config, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                                     ili9225_scanline_fn_t fill, void* user);
+
 /**
  * @brief Set the color order (RGB or BGR) for the display
  * 
@@ -263,4 +743,137 @@ void ili9225_set_color_order(ili9225_t* config, bool is_rgb);
  * @return void
  */
 void ili9225_refresh_display(ili9225_t* config);
+
+// Clipping & Translation
+
+/**
+ * @brief Offset every drawing coordinate that follows
+ *
+ * Drawing coordinate (0, 0) lands on screen position (x, y), so a widget can
+ * draw itself in local coordinates. Applies to all primitives, text, images
+ * and ili9225_push_clip, but not to ili9225_set_window/ili9225_write_pixels.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param x Screen column of drawing X 0 (may be negative)
+ * @param y Screen row of drawing Y 0 (may be negative)
+ * @return void
+ */
+void ili9225_set_origin(ili9225_t* config, int16_t x, int16_t y);
+
+/**
+ * @brief Restrict drawing to a rectangle, saving the current clip
+ *
+ * The new clip is the intersection of the rectangle (in drawing
+ * coordinates) with the current clip, so nested clips only ever shrink.
+ * Primitives clip whole spans, glyph rows and image rows against it before
+ * anything is rasterized or sent.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the top-left corner
+ * @param y Y coordinate of the top-left corner
+ * @param w Width of the rectangle
+ * @param h Height of the rectangle
+ * @return false if ILI9225_CLIP_STACK_DEPTH clips are already pushed (clip unchanged)
+ */
+bool ili9225_push_clip(ili9225_t* config, int16_t x, int16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief Restore the clip saved by the matching ili9225_push_clip
+ *
+ * @param config Pointer to ili9225_t structure
+ * @return void
+ */
+void ili9225_pop_clip(ili9225_t* config);
+
+/**
+ * @brief Drop every pushed clip and allow drawing on the whole screen
+ *
+ * @param config Pointer to ili9225_t structure
+ * @return void
+ */
+void ili9225_reset_clip(ili9225_t* config);
+
+// Framebuffer Mode
+
+/**
+ * @brief Attach (or detach) a RAM framebuffer
+ * 
+ * While attached, every drawing function renders into the buffer instead of
+ * the panel; call ili9225_flush to send the changes. The buffer holds
+ * width * height pixels in the current orientation, row-major. Attaching
+ * marks the whole screen dirty.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param buffer ILI9225_FRAMEBUFFER_PIXELS RGB565 pixels, or NULL to draw directly again
+ * @return void
+ */
+void ili9225_set_framebuffer(ili9225_t* config, uint16_t* buffer);
+
+/**
+ * @brief Attach a palettized framebuffer
+ * 
+ * Like ili9225_set_framebuffer, but each pixel is a palette index of bpp
+ * bits (8 bpp = 38 KB, 4 bpp = 19 KB, 1 bpp = 4.8 KB). While attached, the
+ * colour argument of every drawing function is a palette index. Indices are
+ * expanded to RGB565 through the palette when flushing. Pixels are packed
+ * most significant bits first; every row starts on a byte boundary.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param buffer ILI9225_INDEXED_FRAMEBUFFER_BYTES(bpp) bytes
+ * @param bpp Bits per pixel: 8, 4, 2 or 1
+ * @param palette 1 << bpp RGB565 colours; read at flush time, not copied
+ * @return void
+ */
+void ili9225_set_indexed_framebuffer(ili9225_t* config, uint8_t* buffer, uint8_t bpp, const uint16_t* palette);
+
+/**
+ * @brief Change the palette of an indexed framebuffer
+ * 
+ * Marks the whole screen dirty, so the next flush repaints every pixel in
+ * the new colours (e.g. a status background changing colour) without
+ * redrawing anything.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param palette 1 << bpp RGB565 colours; read at flush time, not copied
+ * @return void
+ */
+void ili9225_set_palette(ili9225_t* config, const uint16_t* palette);
+
+/**
+ * @brief Mark an area of the framebuffer as needing a flush
+ * 
+ * Drawing functions do this automatically; use it after writing to the
+ * buffer directly.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the top-left corner
+ * @param y Y coordinate of the top-left corner
+ * @param w Width of the area
+ * @param h Height of the area
+ * @return void
+ */
+void ili9225_mark_dirty(ili9225_t* config, int16_t x, int16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief Send the dirty areas of the framebuffer to the panel
+ * 
+ * With ILI9225_TILE_DIFF, dirty areas are checked in ILI9225_TILE_SIZE tiles
+ * against a hash of what was last sent, and tiles that came out unchanged
+ * (e.g. a redraw with the same values) are skipped.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @return void
+ */
+void ili9225_flush(ili9225_t* config);
+
+/**
+ * @brief Forget what the panel is known to show
+ * 
+ * Call after the panel contents changed behind the framebuffer's back (e.g.
+ * after a panel reset) so the next flush sends every dirty tile.
+ * 
+ * @param config Pointer to ili9225_t structure
+ * @return void
+ */
+void ili9225_invalidate_tiles(ili9225_t* config);
 #endif // ILI9225_H
\ No newline at end of file
@@ -0,0 +1,286 @@
+/**
+ * @file ili9225_aa.c
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Anti-aliased lines, circles and arcs (Wu's algorithm)
+ *
+ * Lines step along the major axis with a 16-bit error accumulator whose
+ * top four bits are the coverage of the second pixel (Wu / Abrash). Circles
+ * compute the exact edge position per column with a 4-bit fraction and
+ * mirror it into all eight octants.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#include "ili9225_aa.h"
+#include "ili9225_internal.h"
+#include <stdlib.h>
+#include "rgb565.h"
+
+// Alpha (0..32) of each coverage level
+static const uint8_t aa_alpha[ILI9225_AA_LEVELS] = {
+    0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32
+};
+
+// sin(0..90 degrees) in Q14
+static const uint16_t aa_sin_q14[91] = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+// Arc limits as screen-space direction vectors (Q14)
+typedef struct {
+    int32_t sx, sy;     // Start direction
+    int32_t ex, ey;     // End direction
+    bool wide;          // Sweep larger than 180 degrees
+} aa_sector_t;
+
+// ============================================================================
+// Pixel Output
+// ============================================================================
+
+// Plot at screen coordinates
+static void aa_plot(ili9225_t* lcd, const ili9225_aa_pen_t* pen, int32_t x, int32_t y, uint8_t level) {
+    if (level == 0) return;
+    if (!lcd->framebuffer) {
+        ili9225_plot(lcd, x, y, pen->ramp[level]);
+        return;
+    }
+
+    lcd_clip_t c = lcd_clip(lcd);
+    if (x < c.x1 || x >= c.x2 || y < c.y1 || y >= c.y2) return;
+
+    // Framebuffer pixels are written in place; the caller marks the area dirty
+    uint16_t row = (uint16_t)(y - lcd->fb_y0);
+    if (lcd->fb_bpp != 16) {
+        if (level >= ILI9225_AA_LEVELS / 2) ili9225_fb_store(lcd, (uint16_t)x, row, &pen->fg, 1, false);
+        return;
+    }
+
+    uint16_t* p = (uint16_t*)((uint8_t*)lcd->framebuffer + (uint32_t)row * lcd->fb_stride) + x;
+    if (pen->blend_fb) {
+        uint32_t bg = rgb565_spread(*p) * (RGB565_ALPHA_MAX - aa_alpha[level]);
+        *p = rgb565_pack((pen->fg_part[level] + bg) >> 5);
+    } else {
+        *p = pen->ramp[level];
+    }
+}
+
+// Clip the inclusive screen box of a primitive; false if nothing is visible.
+// The visible part is marked dirty, as pixels are then written in place.
+static bool aa_touch(ili9225_t* lcd, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    lcd_clip_t c = lcd_clip(lcd);
+    if (x1 < c.x1) x1 = c.x1;
+    if (y1 < c.y1) y1 = c.y1;
+    if (x2 >= c.x2) x2 = c.x2 - 1;
+    if (y2 >= c.y2) y2 = c.y2 - 1;
+    if (x2 < x1 || y2 < y1) return false;
+
+    if (lcd->framebuffer && lcd->fb_rows == lcd->height) {
+        ili9225_mark_dirty(lcd, (int16_t)x1, (int16_t)y1, (uint16_t)(x2 - x1 + 1), (uint16_t)(y2 - y1 + 1));
+    }
+    return true;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void ili9225_aa_pen_init(ili9225_aa_pen_t* pen, uint16_t fg, uint16_t bg, bool blend_fb) {
+    if (!pen) return;
+    pen->fg = fg;
+    pen->bg = bg;
+    pen->blend_fb = blend_fb;
+    for (uint8_t i = 0; i < ILI9225_AA_LEVELS; i++) {
+        pen->ramp[i] = rgb565_blend(fg, bg, aa_alpha[i]);
+        pen->fg_part[i] = rgb565_spread(fg) * aa_alpha[i];
+    }
+}
+
+void ili9225_draw_line_aa(ili9225_t* lcd, const ili9225_aa_pen_t* pen,
+                          int16_t ux0, int16_t uy0, int16_t ux1, int16_t uy1) {
+    if (!lcd || !pen) return;
+
+    int32_t dx = (int32_t)ux1 - ux0;
+    int32_t dy = (int32_t)uy1 - uy0;
+    if (dx == 0 || dy == 0 || abs(dx) == abs(dy)) {
+        ili9225_draw_line(lcd, ux0, uy0, ux1, uy1, pen->fg);
+        return;
+    }
+
+    int32_t x0 = (int32_t)ux0 + lcd->origin_x, y0 = (int32_t)uy0 + lcd->origin_y;
+    int32_t x1 = (int32_t)ux1 + lcd->origin_x, y1 = (int32_t)uy1 + lcd->origin_y;
+
+    // Always step downwards
+    if (dy < 0) {
+        int32_t temp = x0; x0 = x1; x1 = temp;
+        temp = y0; y0 = y1; y1 = temp;
+        dx = -dx;
+        dy = -dy;
+    }
+    int32_t xdir = dx > 0 ? 1 : -1;
+    dx = abs(dx);
+
+    if (!aa_touch(lcd, (x0 < x1 ? x0 : x1) - 1, y0, (x0 < x1 ? x1 : x0) + 1, y1 + 1)) return;
+
+    int32_t x = x0, y = y0;
+    uint32_t acc = 0;
+    aa_plot(lcd, pen, x, y, ILI9225_AA_LEVELS - 1);
+
+    if (dx > dy) {
+        // X-major: the pixel below gets the accumulated fraction
+        uint32_t adj = ((uint32_t)dy << 16) / (uint32_t)dx;
+        for (int32_t i = 1; i < dx; i++) {
+            acc += adj;
+            if (acc > 0xFFFF) {
+                acc &= 0xFFFF;
+                y++;
+            }
+            x += xdir;
+            uint8_t w = (uint8_t)(acc >> 12);
+            aa_plot(lcd, pen, x, y, w ^ (ILI9225_AA_LEVELS - 1));
+            aa_plot(lcd, pen, x, y + 1, w);
+        }
+    } else {
+        // Y-major: the pixel beside gets the accumulated fraction
+        uint32_t adj = ((uint32_t)dx << 16) / (uint32_t)dy;
+        for (int32_t i = 1; i < dy; i++) {
+            acc += adj;
+            if (acc > 0xFFFF) {
+                acc &= 0xFFFF;
+                x += xdir;
+            }
+            y++;
+            uint8_t w = (uint8_t)(acc >> 12);
+            aa_plot(lcd, pen, x, y, w ^ (ILI9225_AA_LEVELS - 1));
+            aa_plot(lcd, pen, x + xdir, y, w);
+        }
+    }
+
+    aa_plot(lcd, pen, x1, y1, ILI9225_AA_LEVELS - 1);
+}
+
+// ============================================================================
+// Circles and Arcs
+// ============================================================================
+
+static uint32_t aa_isqrt(uint32_t v) {
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+// sin and cos of a whole number of degrees, Q14
+static void aa_sincos(int32_t deg, int32_t* s, int32_t* c) {
+    deg %= 360;
+    if (deg < 0) deg += 360;
+    int32_t q = deg / 90, a = deg % 90;
+    int32_t sa = aa_sin_q14[a], ca = aa_sin_q14[90 - a];
+    switch (q) {
+        case 0: *s = sa;  *c = ca;  break;
+        case 1: *s = ca;  *c = -sa; break;
+        case 2: *s = -sa; *c = -ca; break;
+        default: *s = -ca; *c = sa; break;
+    }
+}
+
+// Clockwise on screen (y down) from a to b
+static inline int32_t aa_cross(int32_t ax, int32_t ay, int32_t bx, int32_t by) {
+    return ax * by - ay * bx;
+}
+
+static bool aa_in_sector(const aa_sector_t* sec, int32_t dx, int32_t dy) {
+    if (!sec) return true;
+    if (!sec->wide) {
+        return aa_cross(sec->sx, sec->sy, dx, dy) >= 0 && aa_cross(dx, dy, sec->ex, sec->ey) >= 0;
+    }
+    return !(aa_cross(sec->ex, sec->ey, dx, dy) > 0 && aa_cross(dx, dy, sec->sx, sec->sy) > 0);
+}
+
+// Plot offset (dx, dy) from the centre in all four quadrants, once per distinct pixel
+static void aa_plot4(ili9225_t* lcd, const ili9225_aa_pen_t* pen, const aa_sector_t* sec,
+                     int32_t cx, int32_t cy, int32_t dx, int32_t dy, uint8_t level) {
+    if (level == 0) return;
+    if (aa_in_sector(sec, dx, dy)) aa_plot(lcd, pen, cx + dx, cy + dy, level);
+    if (dx && aa_in_sector(sec, -dx, dy)) aa_plot(lcd, pen, cx - dx, cy + dy, level);
+    if (dy) {
+        if (aa_in_sector(sec, dx, -dy)) aa_plot(lcd, pen, cx + dx, cy - dy, level);
+        if (dx && aa_in_sector(sec, -dx, -dy)) aa_plot(lcd, pen, cx - dx, cy - dy, level);
+    }
+}
+
+static void aa_circle(ili9225_t* lcd, const ili9225_aa_pen_t* pen, const aa_sector_t* sec,
+                      int32_t cx, int32_t cy, int32_t r) {
+    if (r > 4095) return; // (r^2 << 8) must fit in 32 bits
+    if (!aa_touch(lcd, cx - r - 1, cy - r - 1, cx + r + 1, cy + r + 1)) return;
+    if (r == 0) {
+        aa_plot4(lcd, pen, sec, cx, cy, 0, 0, ILI9225_AA_LEVELS - 1);
+        return;
+    }
+
+    int32_t r2 = r * r;
+    for (int32_t x = 0;; x++) {
+        // Edge height above column x with a 4-bit fraction
+        uint32_t y16 = aa_isqrt((uint32_t)(r2 - x * x) << 8);
+        int32_t y = (int32_t)(y16 >> 4);
+        uint8_t f = y16 & 15;
+        if (x > y) break;
+
+        // Octant above the diagonal, then its mirror below it
+        aa_plot4(lcd, pen, sec, cx, cy, x, y, f ^ (ILI9225_AA_LEVELS - 1));
+        aa_plot4(lcd, pen, sec, cx, cy, x, y + 1, f);
+        if (x != y) aa_plot4(lcd, pen, sec, cx, cy, y, x, f ^ (ILI9225_AA_LEVELS - 1));
+        aa_plot4(lcd, pen, sec, cx, cy, y + 1, x, f);
+    }
+}
+
+void ili9225_draw_circle_aa(ili9225_t* lcd, const ili9225_aa_pen_t* pen,
+                            int16_t x, int16_t y, uint16_t r) {
+    if (!lcd || !pen) return;
+    aa_circle(lcd, pen, NULL, (int32_t)x + lcd->origin_x, (int32_t)y + lcd->origin_y, r);
+}
+
+void ili9225_draw_arc_aa(ili9225_t* lcd, const ili9225_aa_pen_t* pen,
+                         int16_t x, int16_t y, uint16_t r, int16_t start_deg, int16_t end_deg) {
+    if (!lcd || !pen) return;
+
+    int32_t cx = (int32_t)x + lcd->origin_x, cy = (int32_t)y + lcd->origin_y;
+    int32_t sweep = (int32_t)end_deg - start_deg;
+    if (sweep >= 360 || sweep <= -360) {
+        aa_circle(lcd, pen, NULL, cx, cy, r);
+        return;
+    }
+    sweep %= 360;
+    if (sweep < 0) sweep += 360;
+    if (sweep == 0) return;
+
+    // 0 degrees points up and angles grow clockwise: direction (sin, -cos)
+    aa_sector_t sec;
+    int32_t s, c;
+    aa_sincos(start_deg, &s, &c);
+    sec.sx = s;
+    sec.sy = -c;
+    aa_sincos(end_deg, &s, &c);
+    sec.ex = s;
+    sec.ey = -c;
+    sec.wide = sweep > 180;
+    aa_circle(lcd, pen, &sec, cx, cy, r);
+}
@@ -0,0 +1,96 @@
+/**
+ * @file ili9225_aa.h
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Anti-aliased lines, circles and arcs (Wu's algorithm)
+ *
+ * Edge pixels are drawn at one of 16 coverage levels. The colours for every
+ * level are computed once per pen, so plotting a pixel is a table lookup
+ * (plus one multiply when blending against the framebuffer).
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#ifndef ILI9225_AA_H
+#define ILI9225_AA_H
+
+#include "ili9225.h"
+
+// Coverage levels per pixel
+#define ILI9225_AA_LEVELS 16
+
+// Colours of an anti-aliased primitive
+typedef struct {
+    uint16_t fg;                            // Line colour (a palette index on indexed framebuffers)
+    uint16_t bg;                            // Background the edges fade into
+    bool blend_fb;                          // Blend against the framebuffer contents instead of bg
+    uint16_t ramp[ILI9225_AA_LEVELS];       // fg over bg at each coverage level
+    uint32_t fg_part[ILI9225_AA_LEVELS];    // fg's share at each level, spread for rgb565 blending
+} ili9225_aa_pen_t;
+
+/**
+ * @brief Precompute the blend tables of a pen
+ *
+ * With blend_fb, edges blend into whatever an RGB565 framebuffer already
+ * holds. Without a framebuffer they blend into bg, which should match what
+ * is on screen behind the primitive. Indexed framebuffers cannot blend:
+ * pixels at least half covered get fg, the rest are left alone.
+ *
+ * @param pen Pen to initialize
+ * @param fg Line colour
+ * @param bg Background colour
+ * @param blend_fb Blend against the framebuffer contents when one is attached
+ * @return void
+ */
+void ili9225_aa_pen_init(ili9225_aa_pen_t* pen, uint16_t fg, uint16_t bg, bool blend_fb);
+
+/**
+ * @brief Draw an anti-aliased line
+ *
+ * Horizontal, vertical and 45-degree lines have no partial pixels and are
+ * drawn as with ili9225_draw_line.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param pen Colours and blend tables
+ * @param x0 Starting X coordinate
+ * @param y0 Starting Y coordinate
+ * @param x1 Ending X coordinate
+ * @param y1 Ending Y coordinate
+ * @return void
+ */
+void ili9225_draw_line_aa(ili9225_t* config, const ili9225_aa_pen_t* pen,
+                          int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/**
+ * @brief Draw an anti-aliased circle outline
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param pen Colours and blend tables
+ * @param x X coordinate of the center
+ * @param y Y coordinate of the center
+ * @param r Radius
+ * @return void
+ */
+void ili9225_draw_circle_aa(ili9225_t* config, const ili9225_aa_pen_t* pen,
+                            int16_t x, int16_t y, uint16_t r);
+
+/**
+ * @brief Draw an anti-aliased circular arc
+ *
+ * Angles are in degrees, clockwise from 12 o'clock, so a gauge sweeping
+ * from 7 to 5 o'clock is 210..150 (or -150..150). A sweep of 360 degrees
+ * or more draws the whole circle.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param pen Colours and blend tables
+ * @param x X coordinate of the center
+ * @param y Y coordinate of the center
+ * @param r Radius
+ * @param start_deg Angle where the arc starts
+ * @param end_deg Angle where the arc ends, clockwise from start_deg
+ * @return void
+ */
+void ili9225_draw_arc_aa(ili9225_t* config, const ili9225_aa_pen_t* pen,
+                         int16_t x, int16_t y, uint16_t r, int16_t start_deg, int16_t end_deg);
+
+#endif // ILI9225_AA_H
@@ -0,0 +1,309 @@
+/**
+ * @file ili9225_band.c
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Display-list recording and banded (strip) rendering for the ILI9225 driver
+ *
+ * A band is an ordinary framebuffer that holds only rows fb_y0 ..
+ * fb_y0 + fb_rows - 1. The drawing primitives clip their rows to that range,
+ * so replaying a command into a band only touches the rows it owns.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#include "ili9225_band.h"
+#include "ili9225_internal.h"
+#include "log.h"
+
+enum {
+    DL_FILL_SCREEN,
+    DL_FILL_RECT,
+    DL_DRAW_PIXEL,
+    DL_DRAW_LINE,
+    DL_DRAW_RECT,
+    DL_DRAW_CIRCLE,
+    DL_FILL_CIRCLE,
+    DL_FILL_ELLIPSE,
+    DL_FILL_RING,
+    DL_FILL_TRIANGLE,
+    DL_GFX_TEXT,
+    DL_RGB565,
+};
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+void ili9225_dl_init(ili9225_dl_t* dl, ili9225_dl_cmd_t* cmds, uint16_t capacity) {
+    if (!dl) return;
+    dl->cmds = cmds;
+    dl->capacity = cmds ? capacity : 0;
+    ili9225_dl_clear(dl);
+}
+
+void ili9225_dl_clear(ili9225_dl_t* dl) {
+    if (!dl) return;
+    dl->count = 0;
+    dl->overflow = false;
+}
+
+// Append a command covering rows top..bottom in drawing coordinates; returns
+// NULL when full. Whether they are on screen depends on the origin at replay.
+static ili9225_dl_cmd_t* dl_add(ili9225_dl_t* dl, uint8_t op, uint16_t color, int32_t top, int32_t bottom) {
+    if (!dl) return NULL;
+    if (dl->count >= dl->capacity) {
+        if (!dl->overflow) {
+            LOG_WARN("display list full (%u commands), dropping calls", (unsigned)dl->capacity);
+        }
+        dl->overflow = true;
+        return NULL;
+    }
+    ili9225_dl_cmd_t* cmd = &dl->cmds[dl->count++];
+    cmd->op = op;
+    cmd->color = color;
+    cmd->top = top < INT16_MIN ? INT16_MIN : (int16_t)top;
+    cmd->bottom = bottom > INT16_MAX ? INT16_MAX : (int16_t)bottom;
+    cmd->data = NULL;
+    cmd->font = NULL;
+    return cmd;
+}
+
+static inline int32_t min3(int32_t a, int32_t b, int32_t c) {
+    int32_t m = a < b ? a : b;
+    return m < c ? m : c;
+}
+
+static inline int32_t max3(int32_t a, int32_t b, int32_t c) {
+    int32_t m = a > b ? a : b;
+    return m > c ? m : c;
+}
+
+void ili9225_dl_fill_screen(ili9225_dl_t* dl, uint16_t color) {
+    // Screen coordinates, so every band whatever the origin
+    dl_add(dl, DL_FILL_SCREEN, color, INT16_MIN, INT16_MAX);
+}
+
+void ili9225_dl_draw_pixel(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t color) {
+    ili9225_dl_cmd_t* cmd = dl_add(dl, DL_DRAW_PIXEL, color, y, y);
+    if (!cmd) return;
+    cmd->arg[0] = x;
+    cmd->arg[1] = y;
+}
+
+void ili9225_dl_draw_line(ili9225_dl_t* dl, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    ili9225_dl_cmd_t* cmd = dl_add(dl, DL_DRAW_LINE, color, y0 < y1 ? y0 : y1, y0 > y1 ? y0 : y1);
+    if (!cmd) return;
+    cmd->arg[0] = x0;
+    cmd->arg[1] = y0;
+    cmd->arg[2] = x1;
+    cmd->arg[3] = y1;
+}
+
+static ili9225_dl_cmd_t* dl_rect(ili9225_dl_t* dl, uint8_t op, int16_t x, int16_t y,
+                                 uint16_t w, uint16_t h, uint16_t color) {
+    if (w == 0 || h == 0) return NULL;
+    ili9225_dl_cmd_t* cmd = dl_add(dl, op, color, y, (int32_t)y + h - 1);
+    if (!cmd) return NULL;
+    cmd->arg[0] = x;
+    cmd->arg[1] = y;
+    cmd->arg[2] = (int16_t)w; // Read back as uint16_t
+    cmd->arg[3] = (int16_t)h;
+    return cmd;
+}
+
+void ili9225_dl_draw_rect(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    dl_rect(dl, DL_DRAW_RECT, x, y, w, h, color);
+}
+
+void ili9225_dl_fill_rect(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    dl_rect(dl, DL_FILL_RECT, x, y, w, h, color);
+}
+
+static void dl_round(ili9225_dl_t* dl, uint8_t op, int16_t x, int16_t y,
+                     uint16_t rx, uint16_t ry, uint16_t extra, uint16_t color) {
+    ili9225_dl_cmd_t* cmd = dl_add(dl, op, color, (int32_t)y - ry, (int32_t)y + ry);
+    if (!cmd) return;
+    cmd->arg[0] = x;
+    cmd->arg[1] = y;
+    cmd->arg[2] = (int16_t)rx;
+    cmd->arg[3] = (int16_t)ry;
+    cmd->arg[4] = (int16_t)extra;
+}
+
+void ili9225_dl_draw_circle(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t r, uint16_t color) {
+    dl_round(dl, DL_DRAW_CIRCLE, x, y, r, r, 0, color);
+}
+
+void ili9225_dl_fill_circle(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t r, uint16_t color) {
+    dl_round(dl, DL_FILL_CIRCLE, x, y, r, r, 0, color);
+}
+
+void ili9225_dl_fill_ellipse(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t rx, uint16_t ry, uint16_t color) {
+    dl_round(dl, DL_FILL_ELLIPSE, x, y, rx, ry, 0, color);
+}
+
+void ili9225_dl_fill_ring(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t r_outer, uint16_t r_inner, uint16_t color) {
+    dl_round(dl, DL_FILL_RING, x, y, r_outer, r_outer, r_inner, color);
+}
+
+void ili9225_dl_fill_triangle(ili9225_dl_t* dl, int16_t x0, int16_t y0,
+                              int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    ili9225_dl_cmd_t* cmd = dl_add(dl, DL_FILL_TRIANGLE, color, min3(y0, y1, y2), max3(y0, y1, y2));
+    if (!cmd) return;
+    cmd->arg[0] = x0;
+    cmd->arg[1] = y0;
+    cmd->arg[2] = x1;
+    cmd->arg[3] = y1;
+    cmd->arg[4] = x2;
+    cmd->arg[5] = y2;
+}
+
+void ili9225_dl_draw_gfx_text(ili9225_dl_t* dl, int16_t x, int16_t y,
+                              const char* text, const GFXfont* font, uint16_t color) {
+    if (!text || !font) return;
+
+    // Rows covered by the glyph boxes, relative to the first baseline
+    int32_t ink_top = 0, ink_bottom = -1, line = 0;
+    for (const char* p = text; *p; p++) {
+        uint8_t c = (uint8_t)*p;
+        if (c == '\n') {
+            line += font->yAdvance;
+        } else if (c >= font->first && c <= font->last) {
+            const GFXglyph* glyph = &font->glyph[c - font->first];
+            if (glyph->height == 0) continue;
+            int32_t top = line + glyph->yOffset;
+            int32_t bottom = top + glyph->height - 1;
+            if (ink_bottom < ink_top) {
+                ink_top = top;
+                ink_bottom = bottom;
+            } else {
+                if (top < ink_top) ink_top = top;
+                if (bottom > ink_bottom) ink_bottom = bottom;
+            }
+        }
+    }
+    if (ink_bottom < ink_top) return; // Nothing to draw
+
+    ili9225_dl_cmd_t* cmd = dl_add(dl, DL_GFX_TEXT, color, y + ink_top, y + ink_bottom);
+    if (!cmd) return;
+    cmd->arg[0] = x;
+    cmd->arg[1] = y;
+    cmd->data = text;
+    cmd->font = font;
+}
+
+void ili9225_dl_draw_rgb565(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                            const uint16_t* pixels) {
+    if (!pixels) return;
+    ili9225_dl_cmd_t* cmd = dl_rect(dl, DL_RGB565, x, y, w, h, 0);
+    if (cmd) cmd->data = pixels;
+}
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+static void dl_replay(ili9225_t* lcd, const ili9225_dl_cmd_t* cmd) {
+    const int16_t* a = cmd->arg;
+    uint16_t w = (uint16_t)a[2], h = (uint16_t)a[3];
+
+    switch (cmd->op) {
+    case DL_FILL_SCREEN:
+        ili9225_fill_screen(lcd, cmd->color);
+        break;
+    case DL_FILL_RECT:
+        ili9225_fill_rect(lcd, a[0], a[1], w, h, cmd->color);
+        break;
+    case DL_DRAW_PIXEL:
+        ili9225_draw_pixel(lcd, a[0], a[1], cmd->color);
+        break;
+    case DL_DRAW_LINE:
+        ili9225_draw_line(lcd, a[0], a[1], a[2], a[3], cmd->color);
+        break;
+    case DL_DRAW_RECT:
+        ili9225_draw_rect(lcd, a[0], a[1], w, h, cmd->color);
+        break;
+    case DL_DRAW_CIRCLE:
+        ili9225_draw_circle(lcd, a[0], a[1], a[2], cmd->color);
+        break;
+    case DL_FILL_CIRCLE:
+        ili9225_fill_circle(lcd, a[0], a[1], a[2], cmd->color);
+        break;
+    case DL_FILL_ELLIPSE:
+        ili9225_fill_ellipse(lcd, a[0], a[1], a[2], a[3], cmd->color);
+        break;
+    case DL_FILL_RING:
+        ili9225_fill_ring(lcd, a[0], a[1], a[2], a[4], cmd->color);
+        break;
+    case DL_FILL_TRIANGLE:
+        ili9225_fill_triangle(lcd, a[0], a[1], a[2], a[3], a[4], a[5], cmd->color);
+        break;
+    case DL_GFX_TEXT:
+        ili9225_draw_gfx_text(lcd, a[0], a[1], (const char*)cmd->data,
+                              (const GFXfont*)cmd->font, cmd->color);
+        break;
+    case DL_RGB565:
+        ili9225_draw_rgb565(lcd, a[0], a[1], w, h, (const uint16_t*)cmd->data);
+        break;
+    default:
+        break;
+    }
+}
+
+// ============================================================================
+// Banded Rendering
+// ============================================================================
+
+void ili9225_dl_render(ili9225_t* lcd, const ili9225_dl_t* dl, uint16_t* strips,
+                       uint16_t band_rows, uint16_t background) {
+    if (!lcd || !dl || !strips || band_rows == 0) return;
+
+    ili9225_wait_idle(lcd);
+    void* saved_fb = lcd->framebuffer;
+    uint8_t saved_bpp = lcd->fb_bpp;
+    uint16_t saved_stride = lcd->fb_stride;
+    uint16_t saved_y0 = lcd->fb_y0;
+    uint16_t saved_rows = lcd->fb_rows;
+
+    // Bands are sent back to back into one full-screen window
+    ili9225_panel_window(lcd, 0, 0, lcd->width - 1, lcd->height - 1);
+
+    uint32_t strip_pixels = (uint32_t)lcd->width * band_rows;
+    uint32_t band = 0;
+    for (uint16_t y0 = 0; y0 < lcd->height; y0 += band_rows, band++) {
+        uint16_t rows = band_rows;
+        if (y0 + rows > lcd->height) rows = lcd->height - y0;
+        int32_t y1 = y0 + rows - 1;
+
+        // The other strip may still be on its way to the panel
+        uint16_t* strip = strips + (band & 1) * strip_pixels;
+        lcd->framebuffer = strip;
+        lcd->fb_bpp = 16;
+        lcd->fb_stride = lcd->width * 2;
+        lcd->fb_y0 = y0;
+        lcd->fb_rows = rows;
+
+        uint32_t count = (uint32_t)lcd->width * rows;
+        for (uint32_t i = 0; i < count; i++) strip[i] = background;
+
+        // Commands record drawing rows; the origin places them on screen
+        for (uint16_t i = 0; i < dl->count; i++) {
+            const ili9225_dl_cmd_t* cmd = &dl->cmds[i];
+            bool all_rows = cmd->op == DL_FILL_SCREEN;
+            if (all_rows || (cmd->bottom + lcd->origin_y >= y0 && cmd->top + lcd->origin_y <= y1)) {
+                dl_replay(lcd, cmd);
+            }
+        }
+
+        ili9225_wait_idle(lcd);
+        ili9225_panel_stream(lcd, strip, count, true, false);
+    }
+
+    ili9225_wait_idle(lcd);
+    ili9225_invalidate_tiles(lcd); // The panel no longer shows what a framebuffer last sent
+    lcd->framebuffer = saved_fb;
+    lcd->fb_bpp = saved_bpp;
+    lcd->fb_stride = saved_stride;
+    lcd->fb_y0 = saved_y0;
+    lcd->fb_rows = saved_rows;
+}
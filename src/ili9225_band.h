@@ -0,0 +1,108 @@
+/**
+ * @file ili9225_band.h
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Display-list recording and banded (strip) rendering for the ILI9225 driver
+ *
+ * For builds that cannot spare a full framebuffer. Drawing calls are recorded
+ * into a display list, then replayed once per horizontal band into a small
+ * RAM strip. Each finished strip is sent by DMA while the next one renders.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#ifndef ILI9225_BAND_H
+#define ILI9225_BAND_H
+
+#include "ili9225.h"
+
+// Default band height in rows
+#ifndef ILI9225_BAND_ROWS
+#define ILI9225_BAND_ROWS 16
+#endif
+
+// Pixels needed for the two ping-pong strips of `rows`-row bands in any orientation
+#define ILI9225_BAND_BUFFER_PIXELS(rows) \
+    (2u * ((ILI9225_LCD_WIDTH > ILI9225_LCD_HEIGHT) ? ILI9225_LCD_WIDTH : ILI9225_LCD_HEIGHT) * (rows))
+
+// One recorded drawing call
+typedef struct {
+    uint8_t op;             // Drawing function (internal)
+    uint16_t color;         // Primary colour
+    int16_t top;            // First row the call can touch, in drawing coordinates
+    int16_t bottom;         // Last row the call can touch, in drawing coordinates
+    int16_t arg[6];         // Coordinates, sizes and radii
+    const void* data;       // Text or pixel data (must outlive the render)
+    const void* font;       // GFX font for text
+} ili9225_dl_cmd_t;
+
+// Display list over caller-provided command storage
+typedef struct {
+    ili9225_dl_cmd_t* cmds; // Command storage
+    uint16_t capacity;      // Commands that fit in `cmds`
+    uint16_t count;         // Commands recorded
+    bool overflow;          // A call was dropped because the list was full
+} ili9225_dl_t;
+
+/**
+ * @brief Initialize an empty display list
+ *
+ * @param dl Display list to initialize
+ * @param cmds Storage for the recorded commands
+ * @param capacity Number of commands that fit in cmds
+ * @return void
+ */
+void ili9225_dl_init(ili9225_dl_t* dl, ili9225_dl_cmd_t* cmds, uint16_t capacity);
+
+/**
+ * @brief Remove all recorded commands
+ *
+ * @param dl Display list
+ * @return void
+ */
+void ili9225_dl_clear(ili9225_dl_t* dl);
+
+// Recorders. Arguments match the immediate-mode functions of the same name;
+// pointers are stored, not copied, and must stay valid until rendering.
+
+void ili9225_dl_fill_screen(ili9225_dl_t* dl, uint16_t color);
+void ili9225_dl_draw_pixel(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t color);
+void ili9225_dl_draw_line(ili9225_dl_t* dl, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+void ili9225_dl_draw_rect(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+void ili9225_dl_fill_rect(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+void ili9225_dl_draw_circle(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t r, uint16_t color);
+void ili9225_dl_fill_circle(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t r, uint16_t color);
+void ili9225_dl_fill_ellipse(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t rx, uint16_t ry, uint16_t color);
+void ili9225_dl_fill_ring(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t r_outer, uint16_t r_inner, uint16_t color);
+void ili9225_dl_fill_triangle(ili9225_dl_t* dl, int16_t x0, int16_t y0,
+                              int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+void ili9225_dl_draw_gfx_text(ili9225_dl_t* dl, int16_t x, int16_t y,
+                              const char* text, const GFXfont* font, uint16_t color);
+void ili9225_dl_draw_rgb565(ili9225_dl_t* dl, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                            const uint16_t* pixels);
+
+/**
+ * @brief Render a display list to the panel one band at a time
+ *
+ * The screen is rendered top to bottom in bands of band_rows rows. Each band
+ * is cleared to the background colour, then every command whose rows
+ * intersect it is replayed with drawing clipped to the band. The finished
+ * strip is sent by DMA while the next band renders into the other half of
+ * the strip buffer. Commands are replayed in recording order, so later calls
+ * draw on top of earlier ones. Recorded coordinates are drawing coordinates:
+ * the origin in effect when rendering places them on screen.
+ *
+ * Any attached framebuffer is detached for the duration of the render and
+ * restored afterwards.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param dl Display list to render
+ * @param strips Two strips of width * band_rows pixels (see ILI9225_BAND_BUFFER_PIXELS)
+ * @param band_rows Rows per band
+ * @param background Colour each band is cleared to
+ * @return void
+ */
+void ili9225_dl_render(ili9225_t* config, const ili9225_dl_t* dl, uint16_t* strips,
+                       uint16_t band_rows, uint16_t background);
+
+#endif // ILI9225_BAND_H
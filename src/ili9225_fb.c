@@ -0,0 +1,427 @@
+/**
+ * @file ili9225_fb.c
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Framebuffer render target and dirty-rectangle flush for the ILI9225 driver
+ * 
+ * When a framebuffer is attached, every drawing primitive writes into RAM
+ * instead of the panel. The regions touched since the last flush are kept
+ * as a short list of dirty rectangles; ili9225_flush() pushes only those
+ * areas to GRAM using DMA. Indexed (palettized) framebuffers are expanded
+ * to RGB565 a row at a time on the way out.
+ * 
+ * Copyright (c) 2025 trung.la
+ */
+
+#include "ili9225.h"
+#include "ili9225_internal.h"
+#include "ili9225_interp.h"
+#include <string.h>
+#include "log.h"
+
+// ============================================================================
+// Dirty Rectangle Tracking
+// ============================================================================
+
+static inline uint32_t rect_area(const ili9225_rect_t* r) {
+    return (uint32_t)r->w * r->h;
+}
+
+static ili9225_rect_t rect_union(const ili9225_rect_t* a, const ili9225_rect_t* b) {
+    int16_t x1 = a->x < b->x ? a->x : b->x;
+    int16_t y1 = a->y < b->y ? a->y : b->y;
+    int16_t x2 = (a->x + a->w > b->x + b->w) ? a->x + a->w : b->x + b->w;
+    int16_t y2 = (a->y + a->h > b->y + b->h) ? a->y + a->h : b->y + b->h;
+    ili9225_rect_t u = { x1, y1, (uint16_t)(x2 - x1), (uint16_t)(y2 - y1) };
+    return u;
+}
+
+static inline bool rect_contains(const ili9225_rect_t* outer, const ili9225_rect_t* inner) {
+    return inner->x >= outer->x && inner->y >= outer->y &&
+           inner->x + inner->w <= outer->x + outer->w &&
+           inner->y + inner->h <= outer->y + outer->h;
+}
+
+static void dirty_remove(ili9225_t* lcd, uint8_t index) {
+    lcd->dirty[index] = lcd->dirty[--lcd->dirty_count];
+}
+
+// Add a rectangle, merging it with existing ones whenever the union costs no
+// more than sending both (plus the cost of an extra window setup).
+static void dirty_add(ili9225_t* lcd, ili9225_rect_t r) {
+    bool merged;
+    do {
+        merged = false;
+        for (uint8_t i = 0; i < lcd->dirty_count; i++) {
+            if (rect_contains(&lcd->dirty[i], &r)) return;
+            ili9225_rect_t u = rect_union(&lcd->dirty[i], &r);
+            if (rect_area(&u) <= rect_area(&lcd->dirty[i]) + rect_area(&r) + ILI9225_DIRTY_MERGE_SLACK) {
+                r = u;
+                dirty_remove(lcd, i);
+                merged = true;
+                break;
+            }
+        }
+    } while (merged);
+
+    if (lcd->dirty_count < ILI9225_MAX_DIRTY_RECTS) {
+        lcd->dirty[lcd->dirty_count++] = r;
+        return;
+    }
+
+    // List full: grow whichever rectangle absorbs r most cheaply
+    uint8_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < lcd->dirty_count; i++) {
+        ili9225_rect_t u = rect_union(&lcd->dirty[i], &r);
+        uint32_t growth = rect_area(&u) - rect_area(&lcd->dirty[i]);
+        if (growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    r = rect_union(&lcd->dirty[best], &r);
+    dirty_remove(lcd, best);
+    dirty_add(lcd, r);
+}
+
+void ili9225_mark_dirty(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    if (!lcd || !lcd->framebuffer || w == 0 || h == 0) return;
+
+    // Clip to the screen
+    int32_t x2 = (int32_t)x + w;
+    int32_t y2 = (int32_t)y + h;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x2 > lcd->width) x2 = lcd->width;
+    if (y2 > lcd->height) y2 = lcd->height;
+    if (x >= x2 || y >= y2) return;
+
+    ili9225_rect_t r = { x, y, (uint16_t)(x2 - x), (uint16_t)(y2 - y) };
+    dirty_add(lcd, r);
+}
+
+// ============================================================================
+// Framebuffer Target
+// ============================================================================
+
+void ili9225_fb_window(ili9225_t* lcd, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    lcd->fb_win_x1 = x1;
+    lcd->fb_win_y1 = y1;
+    lcd->fb_win_x2 = x2;
+    lcd->fb_win_y2 = y2;
+    lcd->fb_cur_x = x1;
+    lcd->fb_cur_y = y1;
+    if (lcd->fb_rows == lcd->height) {
+        // Bands are sent whole by the strip renderer, so only full buffers track damage
+        ili9225_mark_dirty(lcd, x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+    }
+}
+
+// Replicate a palette index across a byte: 1 bpp 0b1 -> 0xFF, 2 bpp 0b10 -> 0xAA, ...
+static inline uint8_t index_fill_byte(uint8_t index, uint8_t bpp) {
+    static const uint8_t spread[9] = { 0, 0xFF, 0x55, 0, 0x11, 0, 0, 0, 0x01 };
+    return (uint8_t)((index & ((1u << bpp) - 1)) * spread[bpp]);
+}
+
+// Write one sub-byte index at pixel position `pos` of a packed row
+static inline void index_put(uint8_t* row, uint32_t pos, uint8_t bpp, uint8_t index) {
+    uint32_t bit = pos * bpp;
+    uint8_t shift = 8 - bpp - (bit & 7);
+    uint8_t mask = (uint8_t)(((1u << bpp) - 1) << shift);
+    row[bit >> 3] = (uint8_t)((row[bit >> 3] & ~mask) | ((index << shift) & mask));
+}
+
+void ili9225_fb_store(ili9225_t* lcd, uint16_t x, uint16_t row, const uint16_t* src, uint32_t count, bool incr) {
+    uint8_t* line = (uint8_t*)lcd->framebuffer + (uint32_t)row * lcd->fb_stride;
+    uint8_t bpp = lcd->fb_bpp;
+
+    if (bpp == 16) {
+        uint16_t* dst = (uint16_t*)line + x;
+        if (incr) {
+            memcpy(dst, src, count * sizeof(uint16_t));
+        } else {
+            uint16_t color = *src;
+            for (uint32_t i = 0; i < count; i++) dst[i] = color;
+        }
+        return;
+    }
+
+    if (incr) {
+        if (bpp == 8) {
+            for (uint32_t i = 0; i < count; i++) line[x + i] = (uint8_t)src[i];
+        } else {
+            for (uint32_t i = 0; i < count; i++) index_put(line, x + i, bpp, (uint8_t)src[i]);
+        }
+        return;
+    }
+
+    // Solid run: partial bytes at the ends, whole bytes in between
+    uint8_t index = (uint8_t)*src;
+    uint8_t per_byte = 8 / bpp;
+    uint32_t pos = x, end = (uint32_t)x + count;
+    while (pos < end && pos % per_byte != 0) index_put(line, pos++, bpp, index);
+    uint32_t bytes = (end - pos) / per_byte;
+    memset(&line[pos / per_byte], index_fill_byte(index, bpp), bytes);
+    pos += bytes * per_byte;
+    while (pos < end) index_put(line, pos++, bpp, index);
+}
+
+void ili9225_fb_write(ili9225_t* lcd, const uint16_t* src, uint32_t count, bool incr) {
+    while (count > 0) {
+        // Pixels left on the current window row
+        uint32_t n = (uint32_t)lcd->fb_win_x2 - lcd->fb_cur_x + 1;
+        if (n > count) n = count;
+
+        // Parts of the window outside the screen (or band) are dropped, as on the panel
+        if (lcd->fb_cur_y >= lcd->fb_y0 && lcd->fb_cur_y < lcd->fb_y0 + lcd->fb_rows &&
+            lcd->fb_cur_x < lcd->width) {
+            uint32_t visible = n;
+            if (lcd->fb_cur_x + visible > lcd->width) visible = lcd->width - lcd->fb_cur_x;
+            ili9225_fb_store(lcd, lcd->fb_cur_x, lcd->fb_cur_y - lcd->fb_y0, src, visible, incr);
+        }
+
+        if (incr) src += n;
+        count -= n;
+        lcd->fb_cur_x += n;
+        if (lcd->fb_cur_x > lcd->fb_win_x2) {
+            lcd->fb_cur_x = lcd->fb_win_x1;
+            lcd->fb_cur_y = (lcd->fb_cur_y >= lcd->fb_win_y2) ? lcd->fb_win_y1 : lcd->fb_cur_y + 1;
+        }
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+static void fb_attach(ili9225_t* lcd, void* buffer, uint8_t bpp, const uint16_t* palette) {
+    ili9225_wait_idle(lcd);
+
+    lcd->framebuffer = buffer;
+    lcd->fb_bpp = bpp;
+    lcd->fb_stride = (bpp == 16) ? lcd->width * 2 : ILI9225_INDEXED_ROW_BYTES(lcd->width, bpp);
+    lcd->palette = palette;
+    lcd->fb_y0 = 0;
+    lcd->fb_rows = lcd->height;
+    lcd->dirty_count = 0;
+    ili9225_invalidate_tiles(lcd);
+    if (buffer) {
+        // The panel contents are unknown relative to the buffer: send it all on the next flush
+        ili9225_fb_window(lcd, 0, 0, lcd->width - 1, lcd->height - 1);
+    }
+}
+
+void ili9225_set_framebuffer(ili9225_t* lcd, uint16_t* buffer) {
+    if (!lcd) return;
+    fb_attach(lcd, buffer, 16, NULL);
+}
+
+void ili9225_set_indexed_framebuffer(ili9225_t* lcd, uint8_t* buffer, uint8_t bpp, const uint16_t* palette) {
+    if (!lcd) return;
+    if (bpp != 8 && bpp != 4 && bpp != 2 && bpp != 1) {
+        LOG_ERROR("set_indexed_framebuffer: unsupported depth %u bpp", (unsigned)bpp);
+        return;
+    }
+    if (buffer && !palette) {
+        LOG_ERROR("set_indexed_framebuffer: palette is NULL");
+        return;
+    }
+    fb_attach(lcd, buffer, bpp, palette);
+}
+
+void ili9225_set_palette(ili9225_t* lcd, const uint16_t* palette) {
+    if (!lcd || !palette || !lcd->framebuffer || lcd->fb_bpp == 16) return;
+    lcd->palette = palette;
+    ili9225_mark_dirty(lcd, 0, 0, lcd->width, lcd->height);
+}
+
+// Push one rectangle of a full-screen buffer to the panel
+static void fb_flush_rect(ili9225_t* lcd, const uint16_t* buffer, const ili9225_rect_t* r) {
+    const uint16_t* row = &buffer[(uint32_t)r->y * lcd->width + r->x];
+    ili9225_panel_window(lcd, r->x, r->y, r->x + r->w - 1, r->y + r->h - 1);
+
+    if (r->w == lcd->width) {
+        // Full-width rows are contiguous in RAM: one transfer
+        ili9225_panel_stream(lcd, row, (uint32_t)r->w * r->h, true, false);
+        return;
+    }
+
+    // Each row continues the same GRAM stream; the CPU queues the next row
+    // as soon as the DMA for the previous one is done
+    for (uint16_t i = 0; i < r->h; i++, row += lcd->width) {
+        ili9225_wait_idle(lcd);
+        ili9225_panel_stream(lcd, row, r->w, true, false);
+    }
+}
+
+#if ILI9225_TILE_DIFF
+
+// ============================================================================
+// Tile Diffing
+// ============================================================================
+
+#define TILE ILI9225_TILE_SIZE
+
+// Most runs of changed tiles one tile row can hold (every other tile)
+#define TILE_MAX_RUNS ((ILI9225_TILE_COLS(ILI9225_LCD_WIDTH > ILI9225_LCD_HEIGHT ? \
+                                          ILI9225_LCD_WIDTH : ILI9225_LCD_HEIGHT) + 1) / 2)
+
+enum { TILE_CLEAN = 0, TILE_SAME = 1, TILE_CHANGED = 2 };
+
+// Horizontal run of changed tiles, open since tile row y0
+typedef struct {
+    uint8_t x0, x1, y0;
+} tile_run_t;
+
+void ili9225_invalidate_tiles(ili9225_t* lcd) {
+    if (!lcd) return;
+    memset(lcd->tile_hash, 0, sizeof(lcd->tile_hash));
+}
+
+// FNV-1a over the tile's pixels, two per step; 0 is reserved for "unknown"
+static uint32_t tile_hash(const ili9225_t* lcd, const uint16_t* buffer, uint16_t tx, uint16_t ty) {
+    uint16_t x = tx * TILE, y = ty * TILE;
+    uint16_t w = (x + TILE > lcd->width) ? lcd->width - x : TILE;
+    uint16_t h = (y + TILE > lcd->height) ? lcd->height - y : TILE;
+
+    uint32_t hash = 2166136261u;
+    const uint16_t* row = &buffer[(uint32_t)y * lcd->width + x];
+    for (uint16_t j = 0; j < h; j++, row += lcd->width) {
+        uint16_t i = 0;
+        for (; i + 1 < w; i += 2) hash = (hash ^ (row[i] | ((uint32_t)row[i + 1] << 16))) * 16777619u;
+        if (i < w) hash = (hash ^ row[i]) * 16777619u;
+    }
+    return hash ? hash : 1;
+}
+
+// Send the part of a changed tile block that is also dirty. Outside the dirty
+// areas the panel already matches the buffer.
+static void tile_send(ili9225_t* lcd, const uint16_t* buffer, const tile_run_t* run, uint8_t last_row,
+                      const ili9225_rect_t* rects, uint8_t count) {
+    int32_t bx1 = run->x0 * TILE, by1 = run->y0 * TILE;
+    int32_t bx2 = (run->x1 + 1) * TILE, by2 = (last_row + 1) * TILE;
+
+    for (uint8_t i = 0; i < count; i++) {
+        const ili9225_rect_t* d = &rects[i];
+        int32_t x1 = d->x > bx1 ? d->x : bx1;
+        int32_t y1 = d->y > by1 ? d->y : by1;
+        int32_t x2 = (d->x + d->w < bx2) ? d->x + d->w : bx2;
+        int32_t y2 = (d->y + d->h < by2) ? d->y + d->h : by2;
+        if (x1 >= x2 || y1 >= y2) continue;
+
+        ili9225_rect_t r = { (int16_t)x1, (int16_t)y1, (uint16_t)(x2 - x1), (uint16_t)(y2 - y1) };
+        fb_flush_rect(lcd, buffer, &r);
+    }
+}
+
+void ili9225_fb_flush_rects(ili9225_t* lcd, const uint16_t* buffer, const ili9225_rect_t* rects, uint8_t count) {
+    uint8_t cols = ILI9225_TILE_COLS(lcd->width);
+    uint8_t rows = ILI9225_TILE_COLS(lcd->height);
+    uint8_t state[ILI9225_TILE_COUNT];
+    memset(state, TILE_CLEAN, sizeof(state));
+
+    // Re-hash every tile touched by a dirty area
+    for (uint8_t i = 0; i < count; i++) {
+        const ili9225_rect_t* d = &rects[i];
+        for (uint8_t ty = d->y / TILE; ty <= (d->y + d->h - 1) / TILE; ty++) {
+            for (uint8_t tx = d->x / TILE; tx <= (d->x + d->w - 1) / TILE; tx++) {
+                uint16_t t = ty * cols + tx;
+                if (state[t] != TILE_CLEAN) continue;
+
+                uint32_t hash = tile_hash(lcd, buffer, tx, ty);
+                if (hash == lcd->tile_hash[t]) {
+                    state[t] = TILE_SAME;
+                    lcd->tiles_skipped++;
+                } else {
+                    state[t] = TILE_CHANGED;
+                    lcd->tile_hash[t] = hash;
+                    lcd->tiles_sent++;
+                }
+            }
+        }
+    }
+
+    // Merge changed tiles into horizontal runs, and runs with the same
+    // extent on consecutive rows into one block, so each block costs a
+    // single window setup
+    tile_run_t open[TILE_MAX_RUNS];
+    tile_run_t next[TILE_MAX_RUNS];
+    uint8_t open_count = 0;
+
+    for (uint8_t ty = 0; ty <= rows; ty++) {
+        uint8_t next_count = 0;
+        for (uint8_t tx = 0; ty < rows && tx < cols; tx++) {
+            if (state[ty * cols + tx] != TILE_CHANGED) continue;
+            tile_run_t run = { tx, tx, ty };
+            while (run.x1 + 1 < cols && state[ty * cols + run.x1 + 1] == TILE_CHANGED) run.x1++;
+            tx = run.x1;
+            next[next_count++] = run;
+        }
+
+        // Carry matching runs down; send the blocks that end on the previous row
+        for (uint8_t i = 0; i < open_count; i++) {
+            bool extended = false;
+            for (uint8_t j = 0; j < next_count; j++) {
+                if (next[j].x0 == open[i].x0 && next[j].x1 == open[i].x1) {
+                    next[j].y0 = open[i].y0;
+                    extended = true;
+                    break;
+                }
+            }
+            if (!extended) tile_send(lcd, buffer, &open[i], ty - 1, rects, count);
+        }
+
+        memcpy(open, next, next_count * sizeof(tile_run_t));
+        open_count = next_count;
+    }
+    ili9225_wait_idle(lcd);
+}
+
+#else
+
+void ili9225_invalidate_tiles(ili9225_t* lcd) {
+    (void)lcd;
+}
+
+void ili9225_fb_flush_rects(ili9225_t* lcd, const uint16_t* buffer, const ili9225_rect_t* rects, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        fb_flush_rect(lcd, buffer, &rects[i]);
+    }
+    ili9225_wait_idle(lcd);
+}
+
+#endif // ILI9225_TILE_DIFF
+
+// Flush an indexed framebuffer through two line buffers: the CPU expands
+// the next row while DMA sends the previous one
+static void fb_flush_indexed(ili9225_t* lcd) {
+    uint16_t lines[2][(ILI9225_LCD_WIDTH > ILI9225_LCD_HEIGHT) ? ILI9225_LCD_WIDTH : ILI9225_LCD_HEIGHT];
+
+    for (uint8_t i = 0; i < lcd->dirty_count; i++) {
+        const ili9225_rect_t* r = &lcd->dirty[i];
+        ili9225_wait_idle(lcd);
+        ili9225_panel_window(lcd, r->x, r->y, r->x + r->w - 1, r->y + r->h - 1);
+
+        const uint8_t* line = (const uint8_t*)lcd->framebuffer + (uint32_t)r->y * lcd->fb_stride;
+        for (uint16_t row = 0; row < r->h; row++, line += lcd->fb_stride) {
+            // The buffer written here was last used two rows ago, and that transfer has finished
+            uint16_t* out = lines[row & 1];
+            ili9225_expand_indices(out, line, r->x, r->w, lcd->fb_bpp, lcd->palette);
+            ili9225_wait_idle(lcd);
+            ili9225_panel_stream(lcd, out, r->w, true, false);
+        }
+    }
+    ili9225_wait_idle(lcd);
+}
+
+void ili9225_flush(ili9225_t* lcd) {
+    if (!lcd || !lcd->framebuffer) return;
+
+    if (lcd->fb_bpp == 16) {
+        ili9225_fb_flush_rects(lcd, lcd->framebuffer, lcd->dirty, lcd->dirty_count);
+    } else {
+        fb_flush_indexed(lcd);
+    }
+    lcd->dirty_count = 0;
+}
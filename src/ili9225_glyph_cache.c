@@ -0,0 +1,166 @@
+/**
+ * @file ili9225_glyph_cache.c
+ * @author trung.la
+ * @date November 12 2025
+ * @brief LRU cache of pre-expanded RGB565 glyph cells for opaque GFX text
+ *
+ * Cells are packed in the arena in entry-table order. New cells are appended;
+ * evicting cells leaves holes that are closed by sliding the later cells
+ * down, so the free space is always one block at the end of the arena.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#include "ili9225_glyph_cache.h"
+#include "ili9225_internal.h"
+#include <string.h>
+#include "log.h"
+
+// ============================================================================
+// Arena Management
+// ============================================================================
+
+void ili9225_glyph_cache_init(ili9225_glyph_cache_t* cache, uint16_t* arena, uint32_t arena_pixels,
+                              ili9225_glyph_entry_t* entries, uint16_t capacity) {
+    if (!cache) return;
+    cache->arena = arena;
+    cache->arena_pixels = arena ? arena_pixels : 0;
+    cache->entries = entries;
+    cache->capacity = entries ? capacity : 0;
+    cache->tick = 0;
+    ili9225_glyph_cache_clear(cache);
+    ili9225_glyph_cache_reset_stats(cache);
+}
+
+void ili9225_glyph_cache_clear(ili9225_glyph_cache_t* cache) {
+    if (!cache) return;
+    cache->count = 0;
+    cache->arena_used = 0;
+}
+
+void ili9225_glyph_cache_reset_stats(ili9225_glyph_cache_t* cache) {
+    if (!cache) return;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+}
+
+// Drop the least recently used cell, leaving a hole in the arena. Returns its size.
+static uint32_t glyph_evict_lru(ili9225_glyph_cache_t* cache) {
+    uint16_t lru = 0;
+    for (uint16_t i = 1; i < cache->count; i++) {
+        if (cache->entries[i].last_used < cache->entries[lru].last_used) lru = i;
+    }
+    uint32_t size = (uint32_t)cache->entries[lru].w * cache->entries[lru].h;
+    memmove(&cache->entries[lru], &cache->entries[lru + 1],
+            (cache->count - lru - 1) * sizeof(cache->entries[0]));
+    cache->count--;
+    cache->evictions++;
+    return size;
+}
+
+// Slide the cells down over any holes so the free space is at the end
+static void glyph_compact(ili9225_glyph_cache_t* cache) {
+    uint32_t used = 0;
+    for (uint16_t i = 0; i < cache->count; i++) {
+        ili9225_glyph_entry_t* e = &cache->entries[i];
+        uint32_t size = (uint32_t)e->w * e->h;
+        if (e->offset != used) {
+            memmove(&cache->arena[used], &cache->arena[e->offset], size * sizeof(uint16_t));
+            e->offset = used;
+        }
+        used += size;
+    }
+    cache->arena_used = used;
+}
+
+// Expand a glyph into its cell: background, with the set bitmap bits in fg
+static void glyph_expand(uint16_t* dst, const GFXfont* font, const GFXglyph* g,
+                         const ili9225_glyph_entry_t* e) {
+    uint32_t size = (uint32_t)e->w * e->h;
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = e->bg;
+    }
+
+    const uint8_t* bitmap = font->bitmap + g->bitmapOffset;
+    uint16_t* row = dst + (g->yOffset - e->dy) * e->w + (g->xOffset - e->dx);
+    uint32_t bit = 0;
+    for (uint8_t y = 0; y < g->height; y++, row += e->w) {
+        // Glyph bitmaps are bit-packed without row padding
+        for (uint8_t x = 0; x < g->width; x++, bit++) {
+            if (bitmap[bit >> 3] & (0x80 >> (bit & 7))) {
+                row[x] = e->fg;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+const uint16_t* ili9225_glyph_cache_get(ili9225_glyph_cache_t* cache, const GFXfont* font, char c,
+                                        uint16_t fg, uint16_t bg, ili9225_glyph_box_t* box) {
+    if (!cache || !font || !box) return NULL;
+    if ((uint8_t)c < font->first || (uint8_t)c > font->last) return NULL;
+
+    cache->tick++;
+    for (uint16_t i = 0; i < cache->count; i++) {
+        ili9225_glyph_entry_t* e = &cache->entries[i];
+        if (e->font == font && e->code == (uint8_t)c && e->fg == fg && e->bg == bg) {
+            e->last_used = cache->tick;
+            cache->hits++;
+            *box = (ili9225_glyph_box_t){ e->dx, e->dy, e->w, e->h };
+            return &cache->arena[e->offset];
+        }
+    }
+    cache->misses++;
+
+    // The cell opaque text would fill for this character
+    const GFXglyph* g = &font->glyph[(uint8_t)c - font->first];
+    int32_t top, bottom;
+    ili9225_gfx_font_extent(font, &top, &bottom);
+    int32_t left = (g->xOffset < 0) ? g->xOffset : 0;
+    int32_t right = (g->xOffset + g->width > g->xAdvance) ? g->xOffset + g->width : g->xAdvance;
+    int32_t w = right - left, h = bottom - top;
+    if (w <= 0 || h <= 0 || w > UINT8_MAX || h > UINT8_MAX || left < INT8_MIN || top < INT8_MIN) {
+        return NULL;
+    }
+    uint32_t size = (uint32_t)w * h;
+    if (size > cache->arena_pixels || cache->capacity == 0) {
+        LOG_DEBUG("glyph_cache: '%c' cell of %lu pixels does not fit", c, (unsigned long)size);
+        return NULL;
+    }
+
+    // Evict until there is a free entry and enough space, then close the holes
+    uint32_t live = cache->arena_used;
+    bool evicted = false;
+    while (cache->count == cache->capacity || cache->arena_pixels - live < size) {
+        live -= glyph_evict_lru(cache);
+        evicted = true;
+    }
+    if (evicted) {
+        glyph_compact(cache);
+    }
+
+    ili9225_glyph_entry_t* e = &cache->entries[cache->count++];
+    *e = (ili9225_glyph_entry_t){
+        .font = font, .fg = fg, .bg = bg, .code = (uint8_t)c,
+        .dx = (int8_t)left, .dy = (int8_t)top, .w = (uint8_t)w, .h = (uint8_t)h,
+        .offset = cache->arena_used, .last_used = cache->tick,
+    };
+    cache->arena_used += size;
+    glyph_expand(&cache->arena[e->offset], font, g, e);
+
+    *box = (ili9225_glyph_box_t){ e->dx, e->dy, e->w, e->h };
+    return &cache->arena[e->offset];
+}
+
+// ============================================================================
+// Display Attachment
+// ============================================================================
+
+void ili9225_set_glyph_cache(ili9225_t* lcd, ili9225_glyph_cache_t* cache) {
+    if (!lcd) return;
+    lcd->glyph_cache = cache;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file ili9225_glyph_cache.h
+ * @author trung.la
+ * @date November 12 2025
+ * @brief LRU cache of pre-expanded RGB565 glyph cells for opaque GFX text
+ *
+ * Opaque text redraws the same few characters in the same colours over and
+ * over. With a cache attached, each character cell is expanded from the 1-bpp
+ * font bitmap once and later sent straight from RAM (by DMA on the panel).
+ * Cells live in a caller-provided arena; when it or the entry table is full,
+ * the least recently used cells are evicted and the arena is compacted.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#ifndef ILI9225_GLYPH_CACHE_H
+#define ILI9225_GLYPH_CACHE_H
+
+#include "ili9225.h"
+
+// One cached glyph cell
+typedef struct {
+    const GFXfont* font;    // Key: font
+    uint16_t fg;            // Key: text colour
+    uint16_t bg;            // Key: background colour
+    uint8_t code;           // Key: character
+    int8_t dx;              // Cell left edge relative to the cursor
+    int8_t dy;              // Cell top edge relative to the baseline
+    uint8_t w, h;           // Cell size in pixels
+    uint32_t offset;        // First pixel in the arena
+    uint32_t last_used;     // Cache tick of the last lookup (LRU order)
+} ili9225_glyph_entry_t;
+
+// Glyph cache over a caller-provided arena and entry table
+typedef struct ili9225_glyph_cache {
+    uint16_t* arena;                // Pixel storage for all cells
+    uint32_t arena_pixels;          // Pixels that fit in `arena`
+    uint32_t arena_used;            // Pixels currently holding cells
+    ili9225_glyph_entry_t* entries; // Cells in arena order
+    uint16_t capacity;              // Entries that fit in `entries`
+    uint16_t count;                 // Cells cached
+    uint32_t tick;                  // Lookup counter for LRU ordering
+    uint32_t hits;                  // Lookups served from the arena
+    uint32_t misses;                // Lookups that expanded a glyph
+    uint32_t evictions;             // Cells dropped to make room
+} ili9225_glyph_cache_t;
+
+// Position and size of a glyph cell returned by ili9225_glyph_cache_get
+typedef struct {
+    int8_t dx;      // Left edge relative to the cursor
+    int8_t dy;      // Top edge relative to the baseline
+    uint8_t w, h;   // Size in pixels
+} ili9225_glyph_box_t;
+
+/**
+ * @brief Initialize an empty glyph cache
+ *
+ * A FreeSansBold24pt7b digit cell is about 1400 pixels; a 9pt one about 250.
+ *
+ * @param cache Cache to initialize
+ * @param arena Storage for the expanded RGB565 cells
+ * @param arena_pixels Number of pixels that fit in arena
+ * @param entries Storage for the cell table
+ * @param capacity Number of entries that fit in entries
+ * @return void
+ */
+void ili9225_glyph_cache_init(ili9225_glyph_cache_t* cache, uint16_t* arena, uint32_t arena_pixels,
+                              ili9225_glyph_entry_t* entries, uint16_t capacity);
+
+/**
+ * @brief Drop every cached cell (statistics are kept)
+ *
+ * @param cache Glyph cache
+ * @return void
+ */
+void ili9225_glyph_cache_clear(ili9225_glyph_cache_t* cache);
+
+/**
+ * @brief Reset the hit, miss and eviction counters
+ *
+ * @param cache Glyph cache
+ * @return void
+ */
+void ili9225_glyph_cache_reset_stats(ili9225_glyph_cache_t* cache);
+
+/**
+ * @brief Look up a glyph cell, expanding and caching it on a miss
+ *
+ * The cell covers the glyph's advance (widened for overhanging ink) and the
+ * tallest glyph extents of the font: the same box opaque text fills. The
+ * pixels stay valid until the next lookup that misses.
+ *
+ * @param cache Glyph cache
+ * @param font GFX font
+ * @param c Character
+ * @param fg Text colour
+ * @param bg Background colour
+ * @param box Receives the cell position and size
+ * @return The cell's w * h pixels, or NULL if the font has no such character or the cell does not fit in the arena
+ */
+const uint16_t* ili9225_glyph_cache_get(ili9225_glyph_cache_t* cache, const GFXfont* font, char c,
+                                        uint16_t fg, uint16_t bg, ili9225_glyph_box_t* box);
+
+/**
+ * @brief Attach (or detach) a glyph cache to a display
+ *
+ * While attached, ili9225_draw_gfx_text_opaque and ili9225_draw_gfx_char_opaque
+ * send each character cell from the cache instead of expanding the font
+ * bitmap row by row. A cache may be shared by several displays.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param cache Glyph cache, or NULL to render from the font bitmaps again
+ * @return void
+ */
+void ili9225_set_glyph_cache(ili9225_t* config, ili9225_glyph_cache_t* cache);
+
+#endif // ILI9225_GLYPH_CACHE_H
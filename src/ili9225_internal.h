@@ -0,0 +1,78 @@
+/**
+ * @file ili9225_internal.h
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Internal helpers shared between the ILI9225 driver translation units
+ * 
+ * Not part of the public API: signatures may change without notice.
+ * 
+ * Copyright (c) 2025 trung.la
+ */
+
+#ifndef ILI9225_INTERNAL_H
+#define ILI9225_INTERNAL_H
+
+#include "ili9225.h"
+
+// --- Panel access (always talks to the display, ignoring any framebuffer) ---
+
+// Set the GRAM window on the panel and open it for pixel data
+void ili9225_panel_window(ili9225_t* lcd, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+// Stream RGB565 pixels into the open panel window; `incr` false repeats *src
+void ili9225_panel_stream(ili9225_t* lcd, const uint16_t* src, uint32_t count, bool incr, bool wait);
+
+// --- Framebuffer target (ili9225_fb.c) ---
+
+// First row the active target can receive (0 on the panel or a full framebuffer)
+static inline int32_t lcd_row_top(const ili9225_t* lcd) {
+    return lcd->framebuffer ? lcd->fb_y0 : 0;
+}
+
+// One past the last row the active target can receive
+static inline int32_t lcd_row_end(const ili9225_t* lcd) {
+    return lcd->framebuffer ? lcd->fb_y0 + lcd->fb_rows : lcd->height;
+}
+
+// --- Clipping ---
+
+// Area primitives may draw to, in screen coordinates (x2/y2 exclusive)
+typedef struct {
+    int32_t x1, y1;
+    int32_t x2, y2;
+} lcd_clip_t;
+
+// The clip rectangle, limited to the rows the active target can receive
+static inline lcd_clip_t lcd_clip(const ili9225_t* lcd) {
+    lcd_clip_t c = { lcd->clip.x, lcd->clip.y, lcd->clip.x + lcd->clip.w, lcd->clip.y + lcd->clip.h };
+    if (c.y1 < lcd_row_top(lcd)) c.y1 = lcd_row_top(lcd);
+    if (c.y2 > lcd_row_end(lcd)) c.y2 = lcd_row_end(lcd);
+    return c;
+}
+
+// Plot one pixel at screen coordinates if it lies inside the clip
+void ili9225_plot(ili9225_t* lcd, int32_t x, int32_t y, uint16_t color);
+
+// --- Text (ili9225.c) ---
+
+// Rows every glyph of a GFX font fits in, relative to the baseline: [*top, *bottom)
+void ili9225_gfx_font_extent(const GFXfont* font, int32_t* top, int32_t* bottom);
+
+// Draw `len` characters of one line of GFX text from cursor x on baseline y
+// (drawing coordinates). Opaque lines fill the box ili9225_draw_gfx_text_opaque does.
+void ili9225_gfx_text_run(ili9225_t* lcd, int32_t x, int32_t y, const char* text, size_t len,
+                          const GFXfont* font, uint16_t fg, uint16_t bg, bool opaque);
+
+// Set the framebuffer write window and mark it dirty
+void ili9225_fb_window(ili9225_t* lcd, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+// Write pixels at the framebuffer window cursor, wrapping like GRAM does
+void ili9225_fb_write(ili9225_t* lcd, const uint16_t* src, uint32_t count, bool incr);
+
+// Store `count` pixels (or palette indices) on framebuffer row `row` from column x; no clipping
+void ili9225_fb_store(ili9225_t* lcd, uint16_t x, uint16_t row, const uint16_t* src, uint32_t count, bool incr);
+
+// Send rectangles of a full-screen RGB565 buffer to the panel and wait for completion
+void ili9225_fb_flush_rects(ili9225_t* lcd, const uint16_t* buffer, const ili9225_rect_t* rects, uint8_t count);
+
+#endif // ILI9225_INTERNAL_H
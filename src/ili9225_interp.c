@@ -0,0 +1,257 @@
+/**
+ * @file ili9225_interp.c
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Pixel kernels accelerated by the RP2040 SIO interpolators
+ *
+ * Each kernel programs lane shift/mask so that a lane result is
+ * base + byte offset of the wanted element; the CPU then only loads from
+ * the returned address. Addresses are 32-bit, as on the RP2040.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#include "ili9225_interp.h"
+#include "ili9225_internal.h"
+#include <stdint.h>
+#if ILI9225_USE_INTERP
+#include "hardware/interp.h"
+#endif
+
+// ============================================================================
+// Portable Kernels
+// ============================================================================
+
+void ili9225_expand_indices_c(uint16_t* out, const uint8_t* line, uint32_t x, uint32_t count,
+                              uint8_t bpp, const uint16_t* palette) {
+    if (bpp == 8) {
+        for (uint32_t i = 0; i < count; i++) out[i] = palette[line[x + i]];
+        return;
+    }
+
+    uint8_t mask = (uint8_t)((1u << bpp) - 1);
+    uint32_t bit = x * bpp;
+    for (uint32_t i = 0; i < count; i++, bit += bpp) {
+        out[i] = palette[(line[bit >> 3] >> (8 - bpp - (bit & 7))) & mask];
+    }
+}
+
+void ili9225_scale_row_c(uint16_t* out, uint32_t count, const uint16_t* src, uint32_t u, uint32_t du) {
+    for (uint32_t i = 0; i < count; i++, u += du) {
+        out[i] = src[u >> 16];
+    }
+}
+
+void ili9225_texture_span_c(uint16_t* out, uint32_t count, const uint16_t* texture,
+                            uint8_t log2_w, uint8_t log2_h, uint32_t u, uint32_t v, int32_t du, int32_t dv) {
+    uint32_t w_mask = (1u << log2_w) - 1;
+    uint32_t h_mask = (1u << log2_h) - 1;
+    for (uint32_t i = 0; i < count; i++, u += (uint32_t)du, v += (uint32_t)dv) {
+        out[i] = texture[(((v >> 16) & h_mask) << log2_w) | ((u >> 16) & w_mask)];
+    }
+}
+
+#if ILI9225_USE_INTERP
+
+// ============================================================================
+// Interpolator Kernels
+// ============================================================================
+
+#define PTR32(p) ((uint32_t)(uintptr_t)(p))
+#define PIXEL_AT(addr) (*(const uint16_t*)(uintptr_t)(addr))
+
+// Program `lane` to return base + ((accum >> shift) & bits lsb..msb)
+static void interp_lane(interp_hw_t* interp, uint lane, uint shift, uint lsb, uint msb,
+                        bool cross, bool add_raw) {
+    interp_config cfg = interp_default_config();
+    interp_config_set_shift(&cfg, shift);
+    interp_config_set_mask(&cfg, lsb, msb);
+    interp_config_set_cross_input(&cfg, cross);
+    interp_config_set_add_raw(&cfg, add_raw);
+    interp_set_config(interp, lane, &cfg);
+}
+
+// Expand whole bytes. The accumulator holds (byte << 1); lane i extracts
+// index i of a group already scaled to a palette byte offset. Lane 1 of each
+// interpolator reads lane 0's accumulator, so one write feeds two lanes.
+static void expand_bytes(uint16_t* out, const uint8_t* src, uint32_t bytes, uint8_t bpp,
+                         const uint16_t* palette) {
+    interp_hw_save_t save0, save1;
+    interp_save(interp0, &save0);
+    interp_save(interp1, &save1);
+
+    // Indices handled per accumulator write: 1 at 8 bpp, 2 at 4 bpp, 4 below
+    uint lanes = (bpp == 8) ? 1 : (bpp == 4) ? 2 : 4;
+    for (uint i = 0; i < lanes; i++) {
+        interp_hw_t* interp = (i < 2) ? interp0 : interp1;
+        interp_lane(interp, i & 1, bpp * (lanes - 1 - i), 1, bpp, i & 1, false);
+        interp_set_base(interp, i & 1, PTR32(palette));
+    }
+
+    switch (bpp) {
+    case 8:
+        for (uint32_t j = 0; j < bytes; j++) {
+            interp_set_accumulator(interp0, 0, (uint32_t)src[j] << 1);
+            *out++ = PIXEL_AT(interp_peek_lane_result(interp0, 0));
+        }
+        break;
+    case 4:
+        for (uint32_t j = 0; j < bytes; j++) {
+            interp_set_accumulator(interp0, 0, (uint32_t)src[j] << 1);
+            *out++ = PIXEL_AT(interp_peek_lane_result(interp0, 0));
+            *out++ = PIXEL_AT(interp_peek_lane_result(interp0, 1));
+        }
+        break;
+    default: {
+        // 2 bpp: one group of four per byte. 1 bpp: the high nibble (accumulator
+        // pre-shifted by 4), then the low nibble.
+        uint groups = 8 / bpp / 4;
+        for (uint32_t j = 0; j < bytes; j++) {
+            uint32_t acc = (uint32_t)src[j] << 1;
+            for (uint g = groups; g-- > 0;) {
+                uint32_t a = acc >> (4 * g);
+                interp_set_accumulator(interp0, 0, a);
+                interp_set_accumulator(interp1, 0, a);
+                *out++ = PIXEL_AT(interp_peek_lane_result(interp0, 0));
+                *out++ = PIXEL_AT(interp_peek_lane_result(interp0, 1));
+                *out++ = PIXEL_AT(interp_peek_lane_result(interp1, 0));
+                *out++ = PIXEL_AT(interp_peek_lane_result(interp1, 1));
+            }
+        }
+        break;
+    }
+    }
+
+    interp_restore(interp0, &save0);
+    interp_restore(interp1, &save1);
+}
+
+void ili9225_expand_indices(uint16_t* out, const uint8_t* line, uint32_t x, uint32_t count,
+                            uint8_t bpp, const uint16_t* palette) {
+    // Partial bytes at either end go through the C kernel
+    uint32_t per_byte = 8 / bpp;
+    uint32_t head = (per_byte - x % per_byte) % per_byte;
+    if (head > count) head = count;
+    ili9225_expand_indices_c(out, line, x, head, bpp, palette);
+    out += head;
+    x += head;
+    count -= head;
+
+    uint32_t bytes = count / per_byte;
+    if (bytes > 0) {
+        expand_bytes(out, line + x / per_byte, bytes, bpp, palette);
+        out += bytes * per_byte;
+        x += bytes * per_byte;
+        count -= bytes * per_byte;
+    }
+    ili9225_expand_indices_c(out, line, x, count, bpp, palette);
+}
+
+void ili9225_scale_row(uint16_t* out, uint32_t count, const uint16_t* src, uint32_t u, uint32_t du) {
+    interp_hw_save_t save;
+    interp_save(interp0, &save);
+
+    // Lane 0 steps u by du on every pop; FULL = src + (u >> 16) * 2
+    interp_lane(interp0, 0, 15, 1, 16, false, true);
+    interp_lane(interp0, 1, 0, 0, 0, false, false);
+    interp_set_base(interp0, 0, du);
+    interp_set_base(interp0, 1, 0);
+    interp_set_base(interp0, 2, PTR32(src));
+    interp_set_accumulator(interp0, 0, u);
+    interp_set_accumulator(interp0, 1, 0);
+
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = PIXEL_AT(interp_pop_full_result(interp0));
+    }
+
+    interp_restore(interp0, &save);
+}
+
+void ili9225_texture_span(uint16_t* out, uint32_t count, const uint16_t* texture,
+                          uint8_t log2_w, uint8_t log2_h, uint32_t u, uint32_t v, int32_t du, int32_t dv) {
+    interp_hw_save_t save;
+    interp_save(interp0, &save);
+
+    // Lane 0: column byte offset, lane 1: row byte offset; both wrap through
+    // their masks and step on every pop. A size-1 axis has no mask bits: its
+    // lane is held at 0 so it adds nothing.
+    if (log2_w > 0) {
+        interp_lane(interp0, 0, 15, 1, log2_w, false, true);
+    } else {
+        interp_lane(interp0, 0, 0, 0, 0, false, true);
+        u = 0;
+        du = 0;
+    }
+    if (log2_h > 0) {
+        interp_lane(interp0, 1, 15 - log2_w, log2_w + 1, log2_w + log2_h, false, true);
+    } else {
+        interp_lane(interp0, 1, 0, 0, 0, false, true);
+        v = 0;
+        dv = 0;
+    }
+    interp_set_base(interp0, 0, (uint32_t)du);
+    interp_set_base(interp0, 1, (uint32_t)dv);
+    interp_set_base(interp0, 2, PTR32(texture));
+    interp_set_accumulator(interp0, 0, u);
+    interp_set_accumulator(interp0, 1, v);
+
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = PIXEL_AT(interp_pop_full_result(interp0));
+    }
+
+    interp_restore(interp0, &save);
+}
+
+#else
+
+void ili9225_expand_indices(uint16_t* out, const uint8_t* line, uint32_t x, uint32_t count,
+                            uint8_t bpp, const uint16_t* palette) {
+    ili9225_expand_indices_c(out, line, x, count, bpp, palette);
+}
+
+void ili9225_scale_row(uint16_t* out, uint32_t count, const uint16_t* src, uint32_t u, uint32_t du) {
+    ili9225_scale_row_c(out, count, src, u, du);
+}
+
+void ili9225_texture_span(uint16_t* out, uint32_t count, const uint16_t* texture,
+                          uint8_t log2_w, uint8_t log2_h, uint32_t u, uint32_t v, int32_t du, int32_t dv) {
+    ili9225_texture_span_c(out, count, texture, log2_w, log2_h, u, v, du, dv);
+}
+
+#endif // ILI9225_USE_INTERP
+
+// ============================================================================
+// Scaled Blit
+// ============================================================================
+
+void ili9225_draw_rgb565_scaled(ili9225_t* lcd, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                                const uint16_t* src, uint16_t src_w, uint16_t src_h) {
+    if (!lcd || !src || w == 0 || h == 0 || src_w == 0 || src_h == 0) return;
+
+    uint32_t du = ((uint32_t)src_w << 16) / w;
+    uint32_t dv = ((uint32_t)src_h << 16) / h;
+
+    // Clipping keeps the mapping of the visible part: skipped rows and
+    // columns advance the source position
+    lcd_clip_t c = lcd_clip(lcd);
+    int32_t x1 = (int32_t)x + lcd->origin_x, y1 = (int32_t)y + lcd->origin_y;
+    int32_t x2 = x1 + w, y2 = y1 + h;
+    uint32_t u = 0, v = 0;
+    if (x1 < c.x1) { u = du * (uint32_t)(c.x1 - x1); x1 = c.x1; }
+    if (y1 < c.y1) { v = dv * (uint32_t)(c.y1 - y1); y1 = c.y1; }
+    if (x2 > c.x2) x2 = c.x2;
+    if (y2 > c.y2) y2 = c.y2;
+    if (x1 >= x2 || y1 >= y2) return;
+
+    uint16_t cw = (uint16_t)(x2 - x1);
+    uint16_t lines[2][(ILI9225_LCD_WIDTH > ILI9225_LCD_HEIGHT) ? ILI9225_LCD_WIDTH : ILI9225_LCD_HEIGHT];
+    ili9225_set_window(lcd, x1, y1, x2 - 1, y2 - 1);
+
+    for (uint16_t row = 0; row < y2 - y1; row++, v += dv) {
+        // Rows alternate buffers; the async write waits for the previous row first
+        uint16_t* out = lines[row & 1];
+        ili9225_scale_row(out, cw, src + (v >> 16) * src_w, u, du);
+        ili9225_write_pixels_async(lcd, out, cw);
+    }
+    if (!lcd->framebuffer) ili9225_wait_idle(lcd);
+}
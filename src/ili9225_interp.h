@@ -0,0 +1,106 @@
+/**
+ * @file ili9225_interp.h
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Pixel kernels accelerated by the RP2040 SIO interpolators
+ *
+ * Palette expansion, nearest-neighbour scaling and texture addressing. On
+ * the device the interpolators generate the source addresses; on host
+ * builds (or with ILI9225_USE_INTERP=0) portable C versions produce
+ * bit-identical results. The C versions are always built, under a _c
+ * suffix, so both paths can be compared.
+ *
+ * Kernels save and restore the interpolator state of the calling core, so
+ * they can be mixed with other interpolator users.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#ifndef ILI9225_INTERP_H
+#define ILI9225_INTERP_H
+
+#include "ili9225.h"
+
+// Use the SIO interpolators (1) or the portable C kernels (0)
+#ifndef ILI9225_USE_INTERP
+#define ILI9225_USE_INTERP PICO_ON_DEVICE
+#endif
+
+/**
+ * @brief Expand packed palette indices to RGB565
+ *
+ * Indices are packed most significant bits first, as in indexed framebuffers.
+ *
+ * @param out count RGB565 pixels
+ * @param line Packed index row
+ * @param x Index of the first pixel within line
+ * @param count Number of pixels to expand
+ * @param bpp Bits per index: 8, 4, 2 or 1
+ * @param palette 1 << bpp RGB565 colours
+ * @return void
+ */
+void ili9225_expand_indices(uint16_t* out, const uint8_t* line, uint32_t x, uint32_t count,
+                            uint8_t bpp, const uint16_t* palette);
+
+/**
+ * @brief Nearest-neighbour resample of one pixel row
+ *
+ * Output pixel i is src[(u + i * du) >> 16].
+ *
+ * @param out count RGB565 pixels
+ * @param count Number of pixels to produce
+ * @param src Source row
+ * @param u Source position of the first pixel, 16.16 fixed point
+ * @param du Source step per output pixel, 16.16 fixed point
+ * @return void
+ */
+void ili9225_scale_row(uint16_t* out, uint32_t count, const uint16_t* src, uint32_t u, uint32_t du);
+
+/**
+ * @brief Sample a wrapping texture along a line in texture space
+ *
+ * Output pixel i is texture[v_i * width + u_i] with u_i = ((u + i * du) >> 16) mod width
+ * and v_i = ((v + i * dv) >> 16) mod height. Rotated, sheared and scaled
+ * spans and repeating tile patterns all reduce to this.
+ *
+ * @param out count RGB565 pixels
+ * @param count Number of pixels to produce
+ * @param texture Row-major RGB565 texture of (1 << log2_w) x (1 << log2_h)
+ * @param log2_w log2 of the texture width (0..15; 0 for a single column)
+ * @param log2_h log2 of the texture height (0 for a single row; log2_w + log2_h at most 16)
+ * @param u Start column, 16.16 fixed point
+ * @param v Start row, 16.16 fixed point
+ * @param du Column step per output pixel, 16.16 fixed point
+ * @param dv Row step per output pixel, 16.16 fixed point
+ * @return void
+ */
+void ili9225_texture_span(uint16_t* out, uint32_t count, const uint16_t* texture,
+                          uint8_t log2_w, uint8_t log2_h, uint32_t u, uint32_t v, int32_t du, int32_t dv);
+
+/**
+ * @brief Draw an RGB565 image scaled to w x h (nearest neighbour)
+ *
+ * Rows are resampled into two line buffers; each row is sent while the
+ * next one is being produced.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param x X coordinate of the top-left corner
+ * @param y Y coordinate of the top-left corner
+ * @param w Drawn width
+ * @param h Drawn height
+ * @param src Source image, row-major
+ * @param src_w Source width
+ * @param src_h Source height
+ * @return void
+ */
+void ili9225_draw_rgb565_scaled(ili9225_t* config, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                                const uint16_t* src, uint16_t src_w, uint16_t src_h);
+
+// Portable reference kernels (same contracts as above)
+void ili9225_expand_indices_c(uint16_t* out, const uint8_t* line, uint32_t x, uint32_t count,
+                              uint8_t bpp, const uint16_t* palette);
+void ili9225_scale_row_c(uint16_t* out, uint32_t count, const uint16_t* src, uint32_t u, uint32_t du);
+void ili9225_texture_span_c(uint16_t* out, uint32_t count, const uint16_t* texture,
+                            uint8_t log2_w, uint8_t log2_h, uint32_t u, uint32_t v, int32_t du, int32_t dv);
+
+#endif // ILI9225_INTERP_H
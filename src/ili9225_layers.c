@@ -0,0 +1,172 @@
+/**
+ * @file ili9225_layers.c
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Tilemap + sprite layer engine composited per scanline
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#include "ili9225_layers.h"
+#include <string.h>
+#include "rgb565.h"
+
+#define MAX_ROWS ((ILI9225_LCD_WIDTH > ILI9225_LCD_HEIGHT) ? ILI9225_LCD_WIDTH : ILI9225_LCD_HEIGHT)
+
+// Euclidean modulo, so negative scroll offsets wrap correctly
+static inline int32_t wrap(int32_t v, int32_t m) {
+    v %= m;
+    return v < 0 ? v + m : v;
+}
+
+// ============================================================================
+// Scanline Compositing
+// ============================================================================
+
+static void layer_tilemap(const ili9225_tilemap_t* map, uint16_t* line, int16_t x, int16_t y, uint16_t w) {
+    int32_t map_px_w = (int32_t)map->map_w * map->tile_w;
+    int32_t map_px_h = (int32_t)map->map_h * map->tile_h;
+    int32_t my = wrap((int32_t)y + map->scroll_y, map_px_h);
+    int32_t mx = wrap((int32_t)x + map->scroll_x, map_px_w);
+
+    const uint8_t* cells = &map->map[(my / map->tile_h) * map->map_w];
+    uint32_t tile_px = (uint32_t)map->tile_w * map->tile_h;
+    uint32_t tile_row = (uint32_t)(my % map->tile_h) * map->tile_w;
+
+    // Copy one run per tile crossed by the row
+    while (w > 0) {
+        uint16_t tx = mx / map->tile_w;
+        uint16_t px = mx % map->tile_w;
+        uint16_t n = map->tile_w - px;
+        if (n > w) n = w;
+
+        const uint16_t* src = &map->tiles[cells[tx] * tile_px + tile_row + px];
+        memcpy(line, src, n * sizeof(uint16_t));
+
+        line += n;
+        w -= n;
+        mx += n;
+        if (mx >= map_px_w) mx = 0;
+    }
+}
+
+static void layer_sprite(const ili9225_sprite_t* s, uint16_t* line, int16_t x, int16_t y, uint16_t w) {
+    if (!s->visible || !s->pixels) return;
+    int32_t sy = (int32_t)y - s->y;
+    if (sy < 0 || sy >= s->h) return;
+
+    // Columns of the sprite that fall inside the line
+    int32_t x1 = s->x > x ? s->x : x;
+    int32_t x2 = ((int32_t)s->x + s->w < (int32_t)x + w) ? (int32_t)s->x + s->w : (int32_t)x + w;
+    if (x1 >= x2) return;
+
+    const uint16_t* src = &s->pixels[(uint32_t)sy * s->w + (x1 - s->x)];
+    rgb565_key_copy_buf(&line[x1 - x], src, x2 - x1, s->key);
+}
+
+static void layers_fill(uint16_t* line, int16_t x, int16_t y, uint16_t w, void* user) {
+    const ili9225_layers_t* layers = (const ili9225_layers_t*)user;
+
+    if (layers->tilemap) {
+        layer_tilemap(layers->tilemap, line, x, y, w);
+    } else {
+        for (uint16_t i = 0; i < w; i++) line[i] = layers->background;
+    }
+
+    for (uint8_t i = 0; i < layers->sprite_count; i++) {
+        layer_sprite(&layers->sprites[i], line, x, y, w);
+    }
+}
+
+// ============================================================================
+// Row Invalidation
+// ============================================================================
+
+static void rows_mark(uint32_t* rows, int32_t y, int32_t h, uint16_t height) {
+    int32_t y2 = y + h;
+    if (y < 0) y = 0;
+    if (y2 > height) y2 = height;
+    for (; y < y2; y++) rows[y >> 5] |= 1u << (y & 31);
+}
+
+static inline bool rows_test(const uint32_t* rows, uint16_t y) {
+    return (rows[y >> 5] >> (y & 31)) & 1;
+}
+
+static bool sprite_changed(const ili9225_sprite_t* s) {
+    if (s->visible != s->shown_visible) return true;
+    if (!s->visible) return false;
+    return s->x != s->shown_x || s->y != s->shown_y ||
+           s->pixels != s->shown_pixels || s->w != s->shown_w || s->h != s->shown_h ||
+           s->key != s->shown_key;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void ili9225_layers_init(ili9225_layers_t* layers, ili9225_tilemap_t* tilemap,
+                         ili9225_sprite_t* sprites, uint8_t count, uint16_t background) {
+    if (!layers) return;
+    layers->tilemap = tilemap;
+    layers->background = background;
+    layers->sprites = sprites;
+    layers->sprite_count = sprites ? count : 0;
+    layers->rows_rendered = 0;
+    ili9225_layers_invalidate(layers);
+}
+
+void ili9225_layers_invalidate(ili9225_layers_t* layers) {
+    if (!layers) return;
+    layers->full_redraw = true;
+}
+
+void ili9225_layers_render(ili9225_t* lcd, ili9225_layers_t* layers) {
+    if (!lcd || !layers) return;
+
+    uint32_t rows[(MAX_ROWS + 31) / 32] = { 0 };
+    bool scrolled = layers->tilemap &&
+                    (layers->tilemap->scroll_x != layers->shown_scroll_x ||
+                     layers->tilemap->scroll_y != layers->shown_scroll_y);
+
+    if (layers->full_redraw || scrolled) {
+        rows_mark(rows, 0, lcd->height, lcd->height);
+    } else {
+        // Rows a sprite left and rows it now covers
+        for (uint8_t i = 0; i < layers->sprite_count; i++) {
+            const ili9225_sprite_t* s = &layers->sprites[i];
+            if (!sprite_changed(s)) continue;
+            if (s->shown_visible) rows_mark(rows, s->shown_y, s->shown_h, lcd->height);
+            if (s->visible) rows_mark(rows, s->y, s->h, lcd->height);
+        }
+    }
+
+    // Each run of dirty rows is one window
+    layers->rows_rendered = 0;
+    for (uint16_t y = 0; y < lcd->height;) {
+        if (!rows_test(rows, y)) {
+            y++;
+            continue;
+        }
+        uint16_t y0 = y;
+        while (y < lcd->height && rows_test(rows, y)) y++;
+        ili9225_render_scanlines_region(lcd, 0, y0, lcd->width, y - y0, layers_fill, layers);
+        layers->rows_rendered += y - y0;
+    }
+
+    for (uint8_t i = 0; i < layers->sprite_count; i++) {
+        ili9225_sprite_t* s = &layers->sprites[i];
+        s->shown_pixels = s->pixels;
+        s->shown_x = s->x;
+        s->shown_y = s->y;
+        s->shown_w = s->w;
+        s->shown_h = s->h;
+        s->shown_key = s->key;
+        s->shown_visible = s->visible;
+    }
+    if (layers->tilemap) {
+        layers->shown_scroll_x = layers->tilemap->scroll_x;
+        layers->shown_scroll_y = layers->tilemap->scroll_y;
+    }
+    layers->full_redraw = false;
+}
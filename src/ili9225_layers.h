@@ -0,0 +1,98 @@
+/**
+ * @file ili9225_layers.h
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Tilemap + sprite layer engine composited per scanline
+ *
+ * A scrollable tilemap background and a list of colour-keyed sprites are
+ * composited one row at a time into the scanline renderer's line buffers,
+ * so no framebuffer is needed. Between frames, only the rows touched by
+ * sprites that moved or changed are rendered again.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#ifndef ILI9225_LAYERS_H
+#define ILI9225_LAYERS_H
+
+#include "ili9225.h"
+
+// Scrollable background made of fixed-size tiles (typically stored in flash)
+typedef struct {
+    const uint16_t* tiles;  // RGB565 tile images, tile_w * tile_h pixels each, back to back
+    const uint8_t* map;     // Tile index of each map cell, map_w * map_h, row-major
+    uint16_t map_w;         // Map width in tiles
+    uint16_t map_h;         // Map height in tiles
+    uint8_t tile_w;         // Tile width in pixels
+    uint8_t tile_h;         // Tile height in pixels
+    int16_t scroll_x;       // Map pixel shown at screen column 0 (wraps around)
+    int16_t scroll_y;       // Map pixel shown at screen row 0 (wraps around)
+} ili9225_tilemap_t;
+
+// Colour-keyed sprite; move it by changing x/y (or swap pixels to animate)
+typedef struct {
+    const uint16_t* pixels; // RGB565 image, w * h pixels, row-major
+    uint16_t w;             // Width in pixels
+    uint16_t h;             // Height in pixels
+    int16_t x;              // Screen position of the top-left corner
+    int16_t y;
+    uint16_t key;           // Pixels of this colour are transparent
+    bool visible;
+
+    // --- Last rendered state (managed by ili9225_layers_render) ---
+    const uint16_t* shown_pixels;
+    int16_t shown_x, shown_y;
+    uint16_t shown_w, shown_h;
+    uint16_t shown_key;
+    bool shown_visible;
+} ili9225_sprite_t;
+
+// Layer stack: background, then sprites in array order (later sprites on top)
+typedef struct {
+    ili9225_tilemap_t* tilemap;  // Background map, or NULL for a solid colour
+    uint16_t background;         // Background colour when there is no tilemap
+    ili9225_sprite_t* sprites;   // Sprite array
+    uint8_t sprite_count;
+    bool full_redraw;            // Render every row next time
+    int16_t shown_scroll_x, shown_scroll_y;
+    uint16_t rows_rendered;      // Rows sent by the last ili9225_layers_render
+} ili9225_layers_t;
+
+/**
+ * @brief Initialize a layer stack; the first render draws the whole screen
+ *
+ * @param layers Layer stack to initialize
+ * @param tilemap Background map, or NULL
+ * @param sprites Sprite array (may be NULL if count is 0)
+ * @param count Number of sprites
+ * @param background Background colour when tilemap is NULL
+ * @return void
+ */
+void ili9225_layers_init(ili9225_layers_t* layers, ili9225_tilemap_t* tilemap,
+                         ili9225_sprite_t* sprites, uint8_t count, uint16_t background);
+
+/**
+ * @brief Render everything on the next ili9225_layers_render
+ *
+ * Needed after changing tiles, the map or the background colour. Scrolling
+ * and sprite changes are detected automatically.
+ *
+ * @param layers Layer stack
+ * @return void
+ */
+void ili9225_layers_invalidate(ili9225_layers_t* layers);
+
+/**
+ * @brief Bring the panel up to date with the layer stack
+ *
+ * Renders full-width rows where a sprite moved, appeared, disappeared or
+ * changed image (both its old and new rows), or every row after scrolling
+ * or invalidation.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param layers Layer stack
+ * @return void
+ */
+void ili9225_layers_render(ili9225_t* config, ili9225_layers_t* layers);
+
+#endif // ILI9225_LAYERS_H
@@ -0,0 +1,146 @@
+/**
+ * @file ili9225_mc.c
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Dual-core double-buffered rendering for the ILI9225 driver
+ *
+ * Handshake over the multicore FIFO:
+ *   core0 -> core1  MC_CMD_FLUSH | front index   send mc->rects from that buffer
+ *   core0 -> core1  MC_CMD_STOP                  leave the service loop
+ *   core1 -> core0  MC_ACK                       previous command finished
+ * Only one command is outstanding at a time (mc->pending), so neither FIFO
+ * can fill up.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#include "ili9225_mc.h"
+#include "ili9225_internal.h"
+#include <string.h>
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "log.h"
+
+#define MC_CMD_FLUSH 0x464C0000u
+#define MC_CMD_STOP  0x53540000u
+#define MC_CMD_MASK  0xFFFF0000u
+#define MC_ACK       0x41434B00u
+
+// ============================================================================
+// Core1 Service Loop
+// ============================================================================
+
+// There is only one core1, so one running instance; set before launch
+static ili9225_mc_t* mc_core1_state;
+
+static void mc_core1_entry(void) {
+    ili9225_mc_t* mc = mc_core1_state;
+
+    for (;;) {
+        uint32_t cmd = multicore_fifo_pop_blocking();
+        if ((cmd & MC_CMD_MASK) == MC_CMD_STOP) break;
+
+        if ((cmd & MC_CMD_MASK) == MC_CMD_FLUSH) {
+            const uint16_t* front = mc->buffers[cmd & 1];
+            ili9225_fb_flush_rects(mc->lcd, front, mc->rects, mc->rect_count);
+        }
+        multicore_fifo_push_blocking(MC_ACK);
+    }
+    multicore_fifo_push_blocking(MC_ACK);
+}
+
+// ============================================================================
+// Core0 Side
+// ============================================================================
+
+// Collect core1's acknowledgement of the outstanding command
+static bool mc_collect(ili9225_mc_t* mc, bool block) {
+    if (!mc->pending) return true;
+    if (!block && !multicore_fifo_rvalid()) return false;
+
+    uint32_t reply = multicore_fifo_pop_blocking();
+    if (reply != MC_ACK) {
+        LOG_WARN("mc: unexpected FIFO word 0x%08lx", (unsigned long)reply);
+    }
+    mc->pending = false;
+    return true;
+}
+
+// Copy rectangles between two full-screen buffers
+static void mc_copy_rects(const ili9225_t* lcd, uint16_t* dst, const uint16_t* src,
+                          const ili9225_rect_t* rects, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        const ili9225_rect_t* r = &rects[i];
+        uint32_t offset = (uint32_t)r->y * lcd->width + r->x;
+        for (uint16_t row = 0; row < r->h; row++, offset += lcd->width) {
+            memcpy(&dst[offset], &src[offset], r->w * sizeof(uint16_t));
+        }
+    }
+}
+
+// Hand the back buffer to core1; the caller has already collected the last ACK
+static void mc_present(ili9225_mc_t* mc) {
+    ili9225_t* lcd = mc->lcd;
+    if (lcd->dirty_count == 0) return; // Nothing changed since the last frame
+
+    uint8_t front = mc->back;
+    memcpy(mc->rects, lcd->dirty, lcd->dirty_count * sizeof(ili9225_rect_t));
+    mc->rect_count = lcd->dirty_count;
+    mc->back ^= 1;
+    mc->pending = true;
+    mc->frames++;
+
+    __dmb(); // Rectangles must be visible to core1 before the command
+    multicore_fifo_push_blocking(MC_CMD_FLUSH | front);
+
+    // Bring the new back buffer up to date while core1 sends the front one;
+    // both only read the front buffer
+    mc_copy_rects(lcd, mc->buffers[mc->back], mc->buffers[front], mc->rects, mc->rect_count);
+    lcd->framebuffer = mc->buffers[mc->back];
+    lcd->dirty_count = 0;
+}
+
+void ili9225_mc_start(ili9225_mc_t* mc, ili9225_t* lcd, uint16_t* buf0, uint16_t* buf1) {
+    if (!mc || !lcd || !buf0 || !buf1) return;
+
+    mc->lcd = lcd;
+    mc->buffers[0] = buf0;
+    mc->buffers[1] = buf1;
+    mc->back = 0;
+    mc->pending = false;
+    mc->rect_count = 0;
+    mc->frames = 0;
+    mc->busy_swaps = 0;
+
+    ili9225_set_framebuffer(lcd, buf0); // Waits for any transfer started on core0
+
+    mc_core1_state = mc;
+    multicore_fifo_drain();
+    multicore_launch_core1(mc_core1_entry);
+}
+
+void ili9225_mc_swap(ili9225_mc_t* mc) {
+    if (!mc || !mc->lcd) return;
+    mc_collect(mc, true);
+    mc_present(mc);
+}
+
+bool ili9225_mc_try_swap(ili9225_mc_t* mc) {
+    if (!mc || !mc->lcd) return false;
+    if (!mc_collect(mc, false)) {
+        mc->busy_swaps++;
+        return false;
+    }
+    mc_present(mc);
+    return true;
+}
+
+void ili9225_mc_stop(ili9225_mc_t* mc) {
+    if (!mc || !mc->lcd) return;
+    mc_collect(mc, true);
+
+    multicore_fifo_push_blocking(MC_CMD_STOP);
+    multicore_fifo_pop_blocking();
+    multicore_reset_core1();
+    mc->lcd = NULL;
+}
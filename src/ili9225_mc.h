@@ -0,0 +1,81 @@
+/**
+ * @file ili9225_mc.h
+ * @author trung.la
+ * @date November 12 2025
+ * @brief Dual-core double-buffered rendering for the ILI9225 driver
+ *
+ * Core0 draws into a back buffer with the normal drawing functions while
+ * core1 owns SPI/DMA and streams the front buffer to the panel. Buffers are
+ * exchanged with a handshake over the RP2040 multicore FIFO, so the drawing
+ * core never waits for a panel transfer unless it asks to.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#ifndef ILI9225_MC_H
+#define ILI9225_MC_H
+
+#include "ili9225.h"
+
+// Double-buffer state shared by both cores
+typedef struct {
+    ili9225_t* lcd;                                 // Display driven by core1
+    uint16_t* buffers[2];                           // Full-screen RGB565 buffers
+    uint8_t back;                                   // Buffer core0 is drawing into
+    bool pending;                                   // Core1 is still sending the front buffer
+    ili9225_rect_t rects[ILI9225_MAX_DIRTY_RECTS];  // Areas core1 sends from the front buffer
+    uint8_t rect_count;
+    uint32_t frames;                                // Frames handed to core1
+    uint32_t busy_swaps;                            // ili9225_mc_try_swap calls refused
+} ili9225_mc_t;
+
+/**
+ * @brief Start double-buffered rendering with core1 as the display owner
+ *
+ * Attaches buf0 as the framebuffer (so the whole screen is sent on the first
+ * swap) and launches core1. From now on core0 must only draw: panel access
+ * such as ili9225_flush, ili9225_set_orientation or async fills belongs to
+ * core1 until ili9225_mc_stop. Core1 and the multicore FIFO must be unused.
+ *
+ * @param mc State to initialize; must stay valid while running
+ * @param config Pointer to an initialized ili9225_t structure
+ * @param buf0 First buffer of ILI9225_FRAMEBUFFER_PIXELS pixels
+ * @param buf1 Second buffer of ILI9225_FRAMEBUFFER_PIXELS pixels
+ * @return void
+ */
+void ili9225_mc_start(ili9225_mc_t* mc, ili9225_t* config, uint16_t* buf0, uint16_t* buf1);
+
+/**
+ * @brief Present the back buffer, waiting for core1 if it is still busy
+ *
+ * The dirty areas of the finished frame are handed to core1 and copied into
+ * the new back buffer, so drawing continues from the frame just presented.
+ *
+ * @param mc Double-buffer state
+ * @return void
+ */
+void ili9225_mc_swap(ili9225_mc_t* mc);
+
+/**
+ * @brief Present the back buffer only if core1 is free
+ *
+ * Never blocks on the panel: when core1 is still sending the previous
+ * frame, nothing changes and drawing can simply continue into the same
+ * back buffer.
+ *
+ * @param mc Double-buffer state
+ * @return true if the frame was handed to core1
+ */
+bool ili9225_mc_try_swap(ili9225_mc_t* mc);
+
+/**
+ * @brief Wait for the last frame, then stop core1
+ *
+ * The back buffer stays attached as an ordinary framebuffer.
+ *
+ * @param mc Double-buffer state
+ * @return void
+ */
+void ili9225_mc_stop(ili9225_mc_t* mc);
+
+#endif // ILI9225_MC_H
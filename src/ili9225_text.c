@@ -0,0 +1,371 @@
+/**
+ * @file ili9225_text.c
+ * @author trung.la
+ * @date November 12 2025
+ * @brief GFX text measurement and layout: bounding boxes, word wrap, alignment,
+ *        incrementally updated text fields
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#include "ili9225_text.h"
+#include "ili9225_internal.h"
+#include <string.h>
+
+// Advance and ink box of a run of characters, relative to the cursor and
+// baseline. The ink box is [x1, x2) x [y1, y2); empty when x2 <= x1.
+typedef struct {
+    int32_t advance;
+    int32_t x1, y1, x2, y2;
+} text_extent_t;
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+static inline const GFXglyph* text_glyph(const GFXfont* font, char c) {
+    if ((uint8_t)c < font->first || (uint8_t)c > font->last) return NULL;
+    return &font->glyph[(uint8_t)c - font->first];
+}
+
+static void text_extent(const GFXfont* font, const char* text, size_t len, text_extent_t* e) {
+    *e = (text_extent_t){ 0, INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN };
+    for (size_t i = 0; i < len; i++) {
+        const GFXglyph* g = text_glyph(font, text[i]);
+        if (!g) continue;
+        if (g->width > 0 && g->height > 0) {
+            int32_t gx = e->advance + g->xOffset;
+            if (gx < e->x1) e->x1 = gx;
+            if (gx + g->width > e->x2) e->x2 = gx + g->width;
+            if (g->yOffset < e->y1) e->y1 = g->yOffset;
+            if (g->yOffset + g->height > e->y2) e->y2 = g->yOffset + g->height;
+        }
+        e->advance += g->xAdvance;
+    }
+    if (e->x2 <= e->x1) {
+        e->x1 = e->x2 = e->y1 = e->y2 = 0;
+    }
+}
+
+// Grow the box [*x1, *x2) x [*y1, *y2) to cover another one; empty boxes are ignored
+static void text_union(int32_t* x1, int32_t* y1, int32_t* x2, int32_t* y2,
+                       int32_t bx1, int32_t by1, int32_t bx2, int32_t by2) {
+    if (bx2 <= bx1 || by2 <= by1) return;
+    if (*x2 <= *x1) {
+        *x1 = bx1; *y1 = by1; *x2 = bx2; *y2 = by2;
+        return;
+    }
+    if (bx1 < *x1) *x1 = bx1;
+    if (by1 < *y1) *y1 = by1;
+    if (bx2 > *x2) *x2 = bx2;
+    if (by2 > *y2) *y2 = by2;
+}
+
+void ili9225_measure_gfx_text(const GFXfont* font, const char* text, ili9225_text_metrics_t* metrics) {
+    if (!metrics) return;
+    *metrics = (ili9225_text_metrics_t){ 0 };
+    if (!font || !text) return;
+
+    int32_t advance = 0, x1 = 0, y1 = 0, x2 = 0, y2 = 0, baseline = 0;
+    for (;;) {
+        size_t len = strcspn(text, "\n");
+        text_extent_t e;
+        text_extent(font, text, len, &e);
+        if (e.advance > advance) advance = e.advance;
+        text_union(&x1, &y1, &x2, &y2, e.x1, baseline + e.y1, e.x2, baseline + e.y2);
+        metrics->lines++;
+        if (text[len] == '\0') break;
+        text += len + 1;
+        baseline += font->yAdvance;
+    }
+
+    metrics->advance = (int16_t)advance;
+    metrics->ink = (ili9225_rect_t){ (int16_t)x1, (int16_t)y1, (uint16_t)(x2 - x1), (uint16_t)(y2 - y1) };
+}
+
+// ============================================================================
+// Layout
+// ============================================================================
+
+// Find the next line of text that fits `width`. Returns its length before any
+// trailing spaces; *next is where the following line starts, or NULL if this
+// was the last line.
+static size_t text_wrap(const GFXfont* font, const char* text, int32_t width, const char** next) {
+    int32_t advance = 0;
+    bool word_seen = false;
+    const char* after_space = NULL;     // Start of the word following the last space
+    size_t len = 0;
+    for (size_t i = 0; text[i] != '\0' && text[i] != '\n'; i++) {
+        const GFXglyph* g = text_glyph(font, text[i]);
+        int32_t step = g ? g->xAdvance : 0;
+        if (text[i] == ' ') {
+            // Spaces may hang past the edge; they are trimmed from the line.
+            // Leading spaces are no break point: the line would be empty.
+            if (word_seen) after_space = &text[i + 1];
+        } else if (advance + step > width && i > 0) {
+            if (after_space) {
+                len = (size_t)(after_space - text);
+            } else {
+                len = i;    // One word wider than the box: break it here
+            }
+            *next = text + len;
+            while (len > 0 && text[len - 1] == ' ') len--;
+            return len;
+        } else {
+            word_seen = true;
+        }
+        advance += step;
+        len = i + 1;
+    }
+
+    *next = (text[len] == '\n') ? &text[len + 1] : NULL;
+    while (len > 0 && text[len - 1] == ' ') len--;
+    return len;
+}
+
+uint16_t ili9225_layout_gfx_text(const GFXfont* font, const char* text, const ili9225_rect_t* box,
+                                 uint8_t align, ili9225_text_line_t* lines, uint16_t max_lines) {
+    if (!font || !text || !box || !lines) return 0;
+
+    uint16_t count = 0;
+    while (text && count < max_lines) {
+        const char* next;
+        size_t len = text_wrap(font, text, box->w, &next);
+        text_extent_t e;
+        text_extent(font, text, len, &e);
+        lines[count++] = (ili9225_text_line_t){ text, (uint16_t)len, 0, 0, (int16_t)e.advance };
+        text = next;
+    }
+    if (count == 0) return 0;
+
+    // The block runs from the font's tallest ascent on the first line to its
+    // deepest descent on the last
+    int32_t top, bottom;
+    ili9225_gfx_font_extent(font, &top, &bottom);
+    int32_t height = (count - 1) * font->yAdvance + (bottom - top);
+    int32_t y = box->y;
+    if (align & ILI9225_ALIGN_MIDDLE) {
+        y += ((int32_t)box->h - height) / 2;
+    } else if (align & ILI9225_ALIGN_BOTTOM) {
+        y += (int32_t)box->h - height;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        int32_t x = box->x;
+        if (align & ILI9225_ALIGN_CENTER) {
+            x += ((int32_t)box->w - lines[i].advance) / 2;
+        } else if (align & ILI9225_ALIGN_RIGHT) {
+            x += (int32_t)box->w - lines[i].advance;
+        }
+        lines[i].x = (int16_t)x;
+        lines[i].baseline = (int16_t)(y - top + i * font->yAdvance);
+    }
+    return count;
+}
+
+// ============================================================================
+// Drawing
+// ============================================================================
+
+ili9225_rect_t ili9225_draw_gfx_text_box(ili9225_t* lcd, const ili9225_rect_t* box, const char* text,
+                                         const GFXfont* font, uint8_t align,
+                                         uint16_t fg, uint16_t bg, bool opaque) {
+    ili9225_rect_t dirty = { 0 };
+    if (!lcd || !box || !text || !font) return dirty;
+
+    ili9225_text_line_t lines[ILI9225_TEXT_MAX_LINES];
+    uint16_t count = ili9225_layout_gfx_text(font, text, box, align, lines, ILI9225_TEXT_MAX_LINES);
+    if (!ili9225_push_clip(lcd, box->x, box->y, box->w, box->h)) return dirty;
+
+    int32_t top, bottom;
+    ili9225_gfx_font_extent(font, &top, &bottom);
+    int32_t x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        const ili9225_text_line_t* l = &lines[i];
+        ili9225_gfx_text_run(lcd, l->x, l->baseline, l->text, l->len, font, fg, bg, opaque);
+
+        text_extent_t e;
+        text_extent(font, l->text, l->len, &e);
+        if (opaque) {
+            // The box ili9225_gfx_text_run filled: advance plus overhanging ink, font height
+            int32_t bx1 = (e.x2 > e.x1 && e.x1 < 0) ? e.x1 : 0;
+            int32_t bx2 = (e.x2 > e.advance) ? e.x2 : e.advance;
+            text_union(&x1, &y1, &x2, &y2, l->x + bx1, l->baseline + top, l->x + bx2, l->baseline + bottom);
+        } else {
+            text_union(&x1, &y1, &x2, &y2, l->x + e.x1, l->baseline + e.y1, l->x + e.x2, l->baseline + e.y2);
+        }
+    }
+    ili9225_pop_clip(lcd);
+
+    // Only the part inside the box was drawn
+    if (x1 < box->x) x1 = box->x;
+    if (y1 < box->y) y1 = box->y;
+    if (x2 > box->x + box->w) x2 = box->x + box->w;
+    if (y2 > box->y + box->h) y2 = box->y + box->h;
+    if (x2 > x1 && y2 > y1) {
+        dirty = (ili9225_rect_t){ (int16_t)x1, (int16_t)y1, (uint16_t)(x2 - x1), (uint16_t)(y2 - y1) };
+    }
+    return dirty;
+}
+
+// ============================================================================
+// Text Field
+// ============================================================================
+
+void ili9225_text_field_init(ili9225_text_field_t* field, const GFXfont* font, int16_t x, int16_t baseline,
+                             uint8_t align, uint16_t fg, uint16_t bg) {
+    if (!field) return;
+    *field = (ili9225_text_field_t){ .font = font, .x = x, .baseline = baseline, .align = align,
+                                     .fg = fg, .bg = bg };
+    if (font) {
+        int32_t top, bottom;
+        ili9225_gfx_font_extent(font, &top, &bottom);
+        field->top = (int16_t)top;
+        field->bottom = (int16_t)bottom;
+    }
+}
+
+void ili9225_text_field_set_colors(ili9225_text_field_t* field, uint16_t fg, uint16_t bg) {
+    if (!field) return;
+    if (fg != field->fg || bg != field->bg) field->repaint = true;
+    field->fg = fg;
+    field->bg = bg;
+}
+
+void ili9225_text_field_invalidate(ili9225_text_field_t* field) {
+    if (!field) return;
+    field->len = 0;
+    field->x1 = field->x2 = 0;
+    field->repaint = false;
+}
+
+// Span [*x1, *x2) of the cell opaque text fills for a glyph with its cursor at
+// x: the advance, widened for overhanging ink. Empty for characters outside the font.
+static void text_cell(const GFXglyph* g, int32_t x, int32_t* x1, int32_t* x2) {
+    *x1 = *x2 = x;
+    if (!g) return;
+    *x2 = x + g->xAdvance;
+    if (g->width > 0 && g->height > 0) {
+        if (x + g->xOffset < *x1) *x1 = x + g->xOffset;
+        if (x + g->xOffset + g->width > *x2) *x2 = x + g->xOffset + g->width;
+    }
+}
+
+static inline bool text_overlap(int32_t a1, int32_t a2, int32_t b1, int32_t b2) {
+    return a1 < b2 && b1 < a2;
+}
+
+ili9225_rect_t ili9225_text_field_update(ili9225_t* lcd, ili9225_text_field_t* field, const char* text) {
+    ili9225_rect_t dirty = { 0 };
+    if (!lcd || !field || !field->font || !text) return dirty;
+    const GFXfont* font = field->font;
+
+    size_t len = strlen(text);
+    if (len > ILI9225_TEXT_FIELD_MAX) len = ILI9225_TEXT_FIELD_MAX;
+    text_extent_t e;
+    text_extent(font, text, len, &e);
+    int32_t x = field->x;
+    if (field->align & ILI9225_ALIGN_CENTER) {
+        x -= e.advance / 2;
+    } else if (field->align & ILI9225_ALIGN_RIGHT) {
+        x -= e.advance;
+    }
+
+    // Place the new characters. One is kept when the same character is on
+    // screen at the same cursor; both lists are in cursor order.
+    int16_t pos[ILI9225_TEXT_FIELD_MAX];
+    int32_t cx1[ILI9225_TEXT_FIELD_MAX], cx2[ILI9225_TEXT_FIELD_MAX];
+    bool redraw[ILI9225_TEXT_FIELD_MAX];
+    bool kept[ILI9225_TEXT_FIELD_MAX] = { false };     // Old characters still in place
+    int32_t nx1 = 0, nx2 = 0;
+    size_t j = 0;
+    for (size_t i = 0; i < len; i++) {
+        const GFXglyph* g = text_glyph(font, text[i]);
+        pos[i] = (int16_t)x;
+        text_cell(g, x, &cx1[i], &cx2[i]);
+        if (cx2[i] > cx1[i]) {
+            if (nx2 <= nx1) {
+                nx1 = cx1[i];
+                nx2 = cx2[i];
+            } else {
+                if (cx1[i] < nx1) nx1 = cx1[i];
+                if (cx2[i] > nx2) nx2 = cx2[i];
+            }
+        }
+
+        while (j < field->len && field->pos[j] < x) j++;
+        redraw[i] = true;
+        if (!field->repaint && j < field->len && field->pos[j] == x && field->text[j] == text[i]) {
+            redraw[i] = false;
+            kept[j++] = true;
+        }
+        if (g) x += g->xAdvance;
+    }
+
+    // A kept cell overlapped by a redrawn cell, or by the old cell of a
+    // character that moved or went, has lost some of its pixels
+    for (bool grew = true; grew; ) {
+        grew = false;
+        for (size_t i = 0; i < len; i++) {
+            if (redraw[i]) continue;
+            bool hit = false;
+            for (size_t k = 0; k < len && !hit; k++) {
+                hit = redraw[k] && text_overlap(cx1[i], cx2[i], cx1[k], cx2[k]);
+            }
+            for (size_t k = 0; k < field->len && !hit; k++) {
+                if (kept[k]) continue;
+                int32_t ox1, ox2;
+                text_cell(text_glyph(font, field->text[k]), field->pos[k], &ox1, &ox2);
+                hit = text_overlap(cx1[i], cx2[i], ox1, ox2);
+            }
+            if (hit) {
+                redraw[i] = true;
+                grew = true;
+            }
+        }
+    }
+
+    int32_t top = field->baseline + field->top, bottom = field->baseline + field->bottom;
+    int32_t x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+
+    // Clear what the old text covered beyond the new cells
+    int32_t clear[2][2] = { { field->x1, field->x2 }, { 0, 0 } };
+    if (nx2 > nx1) {
+        clear[0][1] = (field->x2 < nx1) ? field->x2 : nx1;
+        clear[1][0] = (field->x1 > nx2) ? field->x1 : nx2;
+        clear[1][1] = field->x2;
+    }
+    for (int k = 0; k < 2; k++) {
+        if (clear[k][1] <= clear[k][0] || bottom <= top) continue;
+        ili9225_fill_rect(lcd, (int16_t)clear[k][0], (int16_t)top, (uint16_t)(clear[k][1] - clear[k][0]),
+                          (uint16_t)(bottom - top), field->bg);
+        text_union(&x1, &y1, &x2, &y2, clear[k][0], top, clear[k][1], bottom);
+    }
+
+    // Redraw the changed cells, each run of consecutive ones as one line
+    for (size_t i = 0; i < len; ) {
+        if (!redraw[i]) {
+            i++;
+            continue;
+        }
+        size_t n = 1;
+        while (i + n < len && redraw[i + n]) n++;
+        ili9225_gfx_text_run(lcd, pos[i], field->baseline, &text[i], n, font, field->fg, field->bg, true);
+        for (size_t k = i; k < i + n; k++) {
+            text_union(&x1, &y1, &x2, &y2, cx1[k], top, cx2[k], bottom);
+        }
+        i += n;
+    }
+
+    memcpy(field->text, text, len);
+    memcpy(field->pos, pos, len * sizeof(pos[0]));
+    field->len = (uint8_t)len;
+    field->x1 = (int16_t)nx1;
+    field->x2 = (int16_t)nx2;
+    field->repaint = false;
+
+    if (x2 > x1 && y2 > y1) {
+        dirty = (ili9225_rect_t){ (int16_t)x1, (int16_t)y1, (uint16_t)(x2 - x1), (uint16_t)(y2 - y1) };
+    }
+    return dirty;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file ili9225_text.h
+ * @author trung.la
+ * @date November 12 2025
+ * @brief GFX text measurement and layout: bounding boxes, word wrap, alignment,
+ *        incrementally updated text fields
+ *
+ * Everything is computed from the GFXglyph metrics, so a string can be sized,
+ * wrapped and positioned before anything is drawn.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#ifndef ILI9225_TEXT_H
+#define ILI9225_TEXT_H
+
+#include "ili9225.h"
+
+// Lines ili9225_draw_gfx_text_box can lay out (kept on the stack)
+#ifndef ILI9225_TEXT_MAX_LINES
+#define ILI9225_TEXT_MAX_LINES 8
+#endif
+
+// Characters an ili9225_text_field_t remembers; longer text is truncated
+#ifndef ILI9225_TEXT_FIELD_MAX
+#define ILI9225_TEXT_FIELD_MAX 24
+#endif
+
+// Alignment flags: one horizontal and one vertical value, or'ed together
+#define ILI9225_ALIGN_LEFT   0x00u
+#define ILI9225_ALIGN_CENTER 0x01u
+#define ILI9225_ALIGN_RIGHT  0x02u
+#define ILI9225_ALIGN_TOP    0x00u
+#define ILI9225_ALIGN_MIDDLE 0x04u
+#define ILI9225_ALIGN_BOTTOM 0x08u
+
+// Size of a piece of text, relative to the starting cursor and first baseline
+typedef struct {
+    int16_t advance;        // Cursor movement of the widest line
+    uint16_t lines;         // Number of lines
+    ili9225_rect_t ink;     // Bounding box of the lit pixels (w = h = 0 when nothing is lit)
+} ili9225_text_metrics_t;
+
+// One laid-out line
+typedef struct {
+    const char* text;       // First character of the line
+    uint16_t len;           // Characters on the line, trailing spaces excluded
+    int16_t x;              // Cursor at the first character
+    int16_t baseline;       // Baseline Y
+    int16_t advance;        // Cursor movement of the line
+} ili9225_text_line_t;
+
+// A single line of opaque GFX text that is updated in place. It remembers what
+// is on screen so an update only redraws the character cells that changed.
+typedef struct {
+    const GFXfont* font;
+    int16_t x;                              // Anchor: left edge, centre or right edge per align
+    int16_t baseline;                       // Baseline Y
+    uint8_t align;                          // ILI9225_ALIGN_LEFT, _CENTER or _RIGHT
+    uint16_t fg, bg;
+    int16_t top, bottom;                    // Font extents relative to the baseline
+    bool repaint;                           // Redraw every cell on the next update
+    uint8_t len;                            // Characters on screen
+    char text[ILI9225_TEXT_FIELD_MAX];      // Characters on screen (not terminated)
+    int16_t pos[ILI9225_TEXT_FIELD_MAX];    // Cursor of each character on screen
+    int16_t x1, x2;                         // Span of the cells on screen (empty when x2 <= x1)
+} ili9225_text_field_t;
+
+/**
+ * @brief Measure GFX text without drawing it
+ *
+ * '\n' starts a new line font->yAdvance further down, as in
+ * ili9225_draw_gfx_text.
+ *
+ * @param font Pointer to GFXfont structure defining the font
+ * @param text Null-terminated string to measure
+ * @param metrics Receives the advance, line count and ink bounding box
+ * @return void
+ */
+void ili9225_measure_gfx_text(const GFXfont* font, const char* text, ili9225_text_metrics_t* metrics);
+
+/**
+ * @brief Break text into lines that fit a box and position them
+ *
+ * Lines break at '\n' and, when wider than the box, at the last space that
+ * fits; a single word wider than the box is broken between characters.
+ * Alignment uses each line's advance, so right-aligned numbers keep their
+ * digits in place when only some of them change. The first baseline sits so
+ * the tallest glyph of the font touches the top of the box (ILI9225_ALIGN_TOP).
+ *
+ * @param font Pointer to GFXfont structure defining the font
+ * @param text Null-terminated string to lay out
+ * @param box Rectangle to lay the text out in
+ * @param align ILI9225_ALIGN_* flags
+ * @param lines Receives up to max_lines lines
+ * @param max_lines Capacity of lines; further lines are dropped
+ * @return Number of lines stored
+ */
+uint16_t ili9225_layout_gfx_text(const GFXfont* font, const char* text, const ili9225_rect_t* box,
+                                 uint8_t align, ili9225_text_line_t* lines, uint16_t max_lines);
+
+/**
+ * @brief Draw wrapped and aligned GFX text inside a box
+ *
+ * Drawing is clipped to the box. With `opaque`, each line's box is filled
+ * with bg as by ili9225_draw_gfx_text_opaque; otherwise only the lit pixels
+ * are drawn and bg is ignored.
+ *
+ * The returned rectangle covers every pixel written, which is what a caller
+ * must clear (or redraw behind) before drawing different text in the box.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param box Rectangle to lay the text out in
+ * @param text Null-terminated string to draw
+ * @param font Pointer to GFXfont structure defining the font
+ * @param align ILI9225_ALIGN_* flags
+ * @param fg 16-bit color value of the text
+ * @param bg 16-bit color value of the background
+ * @param opaque Fill the line boxes with bg
+ * @return The area drawn, within box (w = h = 0 if nothing was drawn)
+ */
+ili9225_rect_t ili9225_draw_gfx_text_box(ili9225_t* config, const ili9225_rect_t* box, const char* text,
+                                         const GFXfont* font, uint8_t align,
+                                         uint16_t fg, uint16_t bg, bool opaque);
+
+/**
+ * @brief Initialize a text field with nothing on screen
+ *
+ * @param field Text field to initialize
+ * @param font Pointer to GFXfont structure defining the font
+ * @param x Left edge, centre or right edge of the text, per align
+ * @param baseline Y coordinate of the baseline
+ * @param align ILI9225_ALIGN_LEFT, ILI9225_ALIGN_CENTER or ILI9225_ALIGN_RIGHT
+ * @param fg 16-bit color value of the text
+ * @param bg 16-bit color value of the background
+ * @return void
+ */
+void ili9225_text_field_init(ili9225_text_field_t* field, const GFXfont* font, int16_t x, int16_t baseline,
+                             uint8_t align, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief Change the colours; the next update redraws every cell
+ *
+ * @param field Text field
+ * @param fg 16-bit color value of the text
+ * @param bg 16-bit color value of the background
+ * @return void
+ */
+void ili9225_text_field_set_colors(ili9225_text_field_t* field, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief Forget what the field drew, e.g. after the screen was cleared
+ *
+ * The next update draws the whole text and clears nothing around it.
+ *
+ * @param field Text field
+ * @return void
+ */
+void ili9225_text_field_invalidate(ili9225_text_field_t* field);
+
+/**
+ * @brief Show new text in the field, redrawing only what changed
+ *
+ * Each character owns the cell ili9225_draw_gfx_text_opaque would fill for
+ * it. A cell is redrawn when its character or position differs from what is
+ * on screen, so a character shifted by a neighbour's different xAdvance is
+ * redrawn and one that kept its place is not. Unchanged cells touched by a
+ * redrawn or vacated cell's overhanging ink are redrawn too. Screen area the
+ * old text covered beyond the new one is filled with bg. Consecutive redrawn
+ * cells go out as one window.
+ *
+ * The text is a single line of at most ILI9225_TEXT_FIELD_MAX characters.
+ *
+ * @param config Pointer to ili9225_t structure
+ * @param field Text field
+ * @param text Null-terminated string to show
+ * @return The redrawn cells and cleared area, before clipping (w = h = 0 if nothing changed)
+ */
+ili9225_rect_t ili9225_text_field_update(ili9225_t* config, ili9225_text_field_t* field, const char* text);
+
+#endif // ILI9225_TEXT_H
@@ -0,0 +1,169 @@
+/**
+ * @file rgb565.c
+ * @author trung.la
+ * @date November 12 2025
+ * @brief RGB565 pixel math: blend, fade, brightness, saturating add, colour key
+ *
+ * A pixel pair w = p1 << 16 | p0 is split into two words with at least five
+ * free bits above every field:
+ *
+ *   LO = w & 0x07E0F81F         -> G1 [21..26]  R0 [11..15]  B0 [0..4]
+ *   HI = (w >> 5) & 0x07C0F83F  -> R1 [22..26]  B1 [11..15]  G0 [0..5]
+ *
+ * Multiplying either word by 0..32 (or adding two of them) then works on
+ * three channels at once, and LO | HI << 5 reassembles the pair.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#include "rgb565.h"
+
+#define LO_MASK 0x07E0F81Fu
+#define HI_MASK 0x07C0F83Fu
+
+// Word-sized access to an aligned pixel pair
+typedef uint32_t __attribute__((may_alias)) rgb565_pair_t;
+
+static inline uint32_t pair_load(const uint16_t* p) {
+    return p[0] | ((uint32_t)p[1] << 16);
+}
+
+static inline void pair_store(uint16_t* p, uint32_t w) {
+    *(rgb565_pair_t*)p = w;
+}
+
+static inline uint32_t split_lo(uint32_t w) {
+    return w & LO_MASK;
+}
+
+static inline uint32_t split_hi(uint32_t w) {
+    return (w >> 5) & HI_MASK;
+}
+
+static inline uint32_t join(uint32_t lo, uint32_t hi) {
+    return (lo & LO_MASK) | ((hi & HI_MASK) << 5);
+}
+
+// (a * alpha + b * (32 - alpha)) >> 5 on both halves of a pair
+static inline uint32_t pair_blend(uint32_t a, uint32_t b, uint32_t alpha) {
+    uint32_t beta = 32 - alpha;
+    uint32_t lo = (split_lo(a) * alpha + split_lo(b) * beta) >> 5;
+    uint32_t hi = (split_hi(a) * alpha + split_hi(b) * beta) >> 5;
+    return join(lo, hi);
+}
+
+// ============================================================================
+// Blend / Fade / Brightness
+// ============================================================================
+
+void rgb565_blend_buf(uint16_t* dst, const uint16_t* src, uint32_t count, uint8_t alpha) {
+    if (alpha > 32) alpha = 32;
+    if (count > 0 && ((uintptr_t)dst & 2)) {
+        *dst = rgb565_blend(*src++, *dst, alpha);
+        dst++;
+        count--;
+    }
+    for (; count >= 2; count -= 2, dst += 2, src += 2) {
+        pair_store(dst, pair_blend(pair_load(src), pair_load(dst), alpha));
+    }
+    if (count) *dst = rgb565_blend(*src, *dst, alpha);
+}
+
+void rgb565_fade_buf(uint16_t* dst, uint32_t count, uint16_t color, uint8_t alpha) {
+    if (alpha > 32) alpha = 32;
+    uint32_t pair = color | ((uint32_t)color << 16);
+    uint32_t beta = 32 - alpha;
+
+    // The colour's share is the same for every pixel
+    uint32_t lo_c = split_lo(pair) * alpha;
+    uint32_t hi_c = split_hi(pair) * alpha;
+
+    if (count > 0 && ((uintptr_t)dst & 2)) {
+        *dst = rgb565_blend(color, *dst, alpha);
+        dst++;
+        count--;
+    }
+    for (; count >= 2; count -= 2, dst += 2) {
+        uint32_t w = pair_load(dst);
+        pair_store(dst, join((split_lo(w) * beta + lo_c) >> 5, (split_hi(w) * beta + hi_c) >> 5));
+    }
+    if (count) *dst = rgb565_blend(color, *dst, alpha);
+}
+
+void rgb565_scale_buf(uint16_t* dst, uint32_t count, uint8_t level) {
+    if (level > 32) level = 32;
+    if (count > 0 && ((uintptr_t)dst & 2)) {
+        *dst = rgb565_scale(*dst, level);
+        dst++;
+        count--;
+    }
+    for (; count >= 2; count -= 2, dst += 2) {
+        uint32_t w = pair_load(dst);
+        pair_store(dst, join((split_lo(w) * level) >> 5, (split_hi(w) * level) >> 5));
+    }
+    if (count) *dst = rgb565_scale(*dst, level);
+}
+
+// ============================================================================
+// Saturating Add
+// ============================================================================
+
+// Fields of a summed LO word are saturated from their carry bits:
+// B0 carries into bit 5, R0 into bit 16, G1 into bit 27
+static inline uint32_t sat_lo(uint32_t sum) {
+    uint32_t c5 = sum & 0x00010020u;
+    uint32_t c6 = sum & 0x08000000u;
+    return sum | (c5 - (c5 >> 5)) | (c6 - (c6 >> 6));
+}
+
+// G0 carries into bit 6, B1 into bit 16, R1 into bit 27
+static inline uint32_t sat_hi(uint32_t sum) {
+    uint32_t c5 = sum & 0x08010000u;
+    uint32_t c6 = sum & 0x00000040u;
+    return sum | (c5 - (c5 >> 5)) | (c6 - (c6 >> 6));
+}
+
+static inline uint32_t pair_add_sat(uint32_t a, uint32_t b) {
+    return join(sat_lo(split_lo(a) + split_lo(b)), sat_hi(split_hi(a) + split_hi(b)));
+}
+
+void rgb565_add_sat_buf(uint16_t* dst, const uint16_t* src, uint32_t count) {
+    if (count > 0 && ((uintptr_t)dst & 2)) {
+        *dst = (uint16_t)pair_add_sat(*src++, *dst);
+        dst++;
+        count--;
+    }
+    for (; count >= 2; count -= 2, dst += 2, src += 2) {
+        pair_store(dst, pair_add_sat(pair_load(src), pair_load(dst)));
+    }
+    if (count) *dst = (uint16_t)pair_add_sat(*src, *dst);
+}
+
+// ============================================================================
+// Colour Key
+// ============================================================================
+
+void rgb565_key_copy_buf(uint16_t* dst, const uint16_t* src, uint32_t count, uint16_t key) {
+    uint32_t keys = key | ((uint32_t)key << 16);
+
+    if (count > 0 && ((uintptr_t)dst & 2)) {
+        if (*src != key) *dst = *src;
+        dst++;
+        src++;
+        count--;
+    }
+    for (; count >= 2; count -= 2, dst += 2, src += 2) {
+        uint32_t w = pair_load(src);
+        uint32_t diff = w ^ keys;
+        if (diff == 0) continue; // Both transparent
+
+        if ((diff & 0xFFFFu) && (diff >> 16)) {
+            pair_store(dst, w); // Both opaque
+        } else if (diff & 0xFFFFu) {
+            dst[0] = (uint16_t)w;
+        } else {
+            dst[1] = (uint16_t)(w >> 16);
+        }
+    }
+    if (count && *src != key) *dst = *src;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file rgb565.h
+ * @author trung.la
+ * @date November 12 2025
+ * @brief RGB565 pixel math: blend, fade, brightness, saturating add, colour key
+ *
+ * Buffer kernels work on two pixels per 32-bit word (SWAR): the six colour
+ * fields of a pixel pair are split across two words with enough headroom
+ * between fields for a 5-bit multiply, so each word needs one multiply for
+ * three channels. They run on framebuffers, line buffers and bitmaps alike,
+ * have no Pico SDK dependency and assume a little-endian CPU.
+ *
+ * Alpha and brightness levels are 0..32, where 32 means fully opaque / full
+ * brightness. Results are (a * alpha + b * (32 - alpha)) >> 5 per channel.
+ *
+ * Copyright (c) 2025 trung.la
+ */
+
+#ifndef UTILITIES_RGB565_H
+#define UTILITIES_RGB565_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Full opacity / brightness for the alpha and level arguments
+#define RGB565_ALPHA_MAX 32
+
+// Build an RGB565 colour from 8-bit channels
+static inline uint16_t rgb565_from_rgb888(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+// Spread one pixel as 0b00000GGGGGG00000RRRRR000000BBBBB, leaving room for a 5-bit multiply
+static inline uint32_t rgb565_spread(uint16_t c) {
+    return (c | ((uint32_t)c << 16)) & 0x07E0F81Fu;
+}
+
+static inline uint16_t rgb565_pack(uint32_t spread) {
+    spread &= 0x07E0F81Fu;
+    return (uint16_t)(spread | (spread >> 16));
+}
+
+// fg over bg with alpha 0..32
+static inline uint16_t rgb565_blend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+    return rgb565_pack((rgb565_spread(fg) * alpha + rgb565_spread(bg) * (32u - alpha)) >> 5);
+}
+
+// Scale brightness by level 0..32
+static inline uint16_t rgb565_scale(uint16_t c, uint8_t level) {
+    return rgb565_pack((rgb565_spread(c) * level) >> 5);
+}
+
+/**
+ * @brief Blend src over dst: dst = src * alpha + dst * (32 - alpha)
+ *
+ * @param dst Destination pixels (may equal src)
+ * @param src Source pixels
+ * @param count Number of pixels
+ * @param alpha Source opacity, 0..32
+ * @return void
+ */
+void rgb565_blend_buf(uint16_t* dst, const uint16_t* src, uint32_t count, uint8_t alpha);
+
+/**
+ * @brief Fade pixels towards a colour: dst = color * alpha + dst * (32 - alpha)
+ *
+ * @param dst Pixels to fade in place
+ * @param count Number of pixels
+ * @param color Colour to fade towards
+ * @param alpha Amount of color, 0..32
+ * @return void
+ */
+void rgb565_fade_buf(uint16_t* dst, uint32_t count, uint16_t color, uint8_t alpha);
+
+/**
+ * @brief Scale brightness in place: dst = dst * level / 32
+ *
+ * @param dst Pixels to scale
+ * @param count Number of pixels
+ * @param level Brightness, 0..32
+ * @return void
+ */
+void rgb565_scale_buf(uint16_t* dst, uint32_t count, uint8_t level);
+
+/**
+ * @brief Per-channel saturating add: dst = min(dst + src, channel max)
+ *
+ * @param dst Destination pixels (may equal src)
+ * @param src Pixels to add
+ * @param count Number of pixels
+ * @return void
+ */
+void rgb565_add_sat_buf(uint16_t* dst, const uint16_t* src, uint32_t count);
+
+/**
+ * @brief Copy pixels except those equal to the key colour
+ *
+ * @param dst Destination pixels
+ * @param src Source pixels
+ * @param count Number of pixels
+ * @param key Transparent colour in src
+ * @return void
+ */
+void rgb565_key_copy_buf(uint16_t* dst, const uint16_t* src, uint32_t count, uint16_t key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTILITIES_RGB565_H